@@ -7,10 +7,12 @@ include(cmake/CPM.cmake)
 find_package(Catch2 QUIET)
 find_package(spdlog QUIET)
 find_package(Boost QUIET)
+find_package(benchmark QUIET)
 
 message(STATUS "Catch2_FOUND: ${Catch2_FOUND}")
 message(STATUS "spdlog_FOUND: ${spdlog_FOUND}")
 message(STATUS "Boost_FOUND: ${Boost_FOUND}")
+message(STATUS "benchmark_FOUND: ${benchmark_FOUND}")
 
 function(patatocs_setup_dependencies)
 
@@ -25,6 +27,14 @@ function(patatocs_setup_dependencies)
         cpmaddpackage("gh:gabime/spdlog@1.12.0")
     endif()
 
+    if(patatocs_ENABLE_BENCHMARKS AND NOT TARGET benchmark::benchmark AND NOT benchmark_FOUND)
+        cpmaddpackage(
+            NAME benchmark
+            GITHUB_REPOSITORY google/benchmark
+            VERSION 1.8.3
+            OPTIONS "BENCHMARK_ENABLE_TESTING OFF" "BENCHMARK_ENABLE_INSTALL OFF")
+    endif()
+
     if(NOT TARGET Boost::boost AND NOT Boost_FOUND)
         set(BOOST_VERSION "1.84.0")
         set(BOOST_LIBS system serialization align assert config core static_assert throw_exception array bind chrono integer move mpl predef asio ratio type_traits typeof utility coroutine date_time function regex smart_ptr preprocessor io uuid)
@@ -20,6 +20,8 @@ endmacro()
 macro(patatocs_setup_options)
   option(patatocs_ENABLE_HARDENING "Enable hardening" ON)
   option(patatocs_ENABLE_COVERAGE "Enable coverage reporting" ON)
+  option(patatocs_ENABLE_BENCHMARKS "Build the benchmarks target" OFF)
+  option(patatocs_ENABLE_PROFILING "Record the frame and system durations in World::runSystems" OFF)
   cmake_dependent_option(
     patatocs_ENABLE_GLOBAL_HARDENING
     "Attempt to push hardening options to built dependencies"
@@ -73,6 +75,8 @@ macro(patatocs_setup_options)
       patatocs_ENABLE_CLANG_TIDY
       patatocs_ENABLE_CPPCHECK
       patatocs_ENABLE_COVERAGE
+      patatocs_ENABLE_BENCHMARKS
+      patatocs_ENABLE_PROFILING
       patatocs_ENABLE_PCH
       patatocs_ENABLE_CACHE)
   endif()
@@ -0,0 +1,90 @@
+#ifndef BENCHMARKS_COMPONENTS_HPP_
+#define BENCHMARKS_COMPONENTS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "Core/StaticWorld.hpp"
+#include "Core/World.hpp"
+
+namespace Benchmarks {
+    struct Position
+    {
+            float x;
+            float y;
+    };
+
+    struct Velocity
+    {
+            float dx;
+            float dy;
+    };
+
+    struct Health
+    {
+            int hp;
+    };
+
+    constexpr std::int64_t minEntities = 1'000;
+    constexpr std::int64_t maxEntities = 1'000'000;
+    constexpr std::int64_t entitiesMultiplier = 10;
+    constexpr float deltaTime = 0.016F;
+
+    using StaticBenchWorld = Engine::Core::StaticWorld<Position, Velocity, Health>;
+
+    /**
+     * @brief Add count entities to a world, each having a Position and occupancy percent of them a Velocity
+     *
+     * @tparam WorldType The World or a StaticWorld
+     * @param aWorld The world, its components registered
+     * @param aCount The number of entities
+     * @param aOccupancy The percentage of entities having a Velocity
+     */
+    template<typename WorldType>
+    void populateWorld(WorldType &aWorld, std::size_t aCount, std::size_t aOccupancy)
+    {
+        constexpr std::size_t percent = 100;
+
+        for (std::size_t idx = 0; idx < aCount; idx++) {
+            auto entity = aWorld.createEntity();
+
+            aWorld.addComponentToEntity(entity, Position {static_cast<float>(idx), 0.0F});
+            if (idx % percent < aOccupancy) {
+                aWorld.addComponentToEntity(entity, Velocity {1.0F, 2.0F});
+            }
+        }
+    }
+
+    /**
+     * @brief Build a world with count entities, each having a Position and occupancy percent of them a Velocity
+     *
+     * @param aCount The number of entities
+     * @param aOccupancy The percentage of entities having a Velocity
+     * @return std::unique_ptr<Engine::Core::World> The world
+     */
+    inline std::unique_ptr<Engine::Core::World> makeWorld(std::size_t aCount, std::size_t aOccupancy = 100)
+    {
+        auto world = std::make_unique<Engine::Core::World>();
+
+        world->registerComponents<Position, Velocity, Health>();
+        populateWorld(*world, aCount, aOccupancy);
+        return world;
+    }
+
+    /**
+     * @brief Build the StaticWorld counterpart of makeWorld
+     *
+     * @param aCount The number of entities
+     * @param aOccupancy The percentage of entities having a Velocity
+     * @return std::unique_ptr<StaticBenchWorld> The world
+     */
+    inline std::unique_ptr<StaticBenchWorld> makeStaticWorld(std::size_t aCount, std::size_t aOccupancy = 100)
+    {
+        auto world = std::make_unique<StaticBenchWorld>();
+
+        populateWorld(*world, aCount, aOccupancy);
+        return world;
+    }
+} // namespace Benchmarks
+
+#endif /* !BENCHMARKS_COMPONENTS_HPP_ */
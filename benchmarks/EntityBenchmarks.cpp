@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <memory>
+#include "Components.hpp"
+
+namespace Benchmarks {
+    namespace {
+        void createEntity(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+
+            for (auto iteration : aState) {
+                aState.PauseTiming();
+                auto world = std::make_unique<Engine::Core::World>();
+
+                world->registerComponents<Position, Velocity, Health>();
+                aState.ResumeTiming();
+                for (std::size_t idx = 0; idx < count; idx++) {
+                    benchmark::DoNotOptimize(world->createEntity());
+                }
+                aState.PauseTiming();
+                world.reset();
+                aState.ResumeTiming();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        void killEntity(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+
+            for (auto iteration : aState) {
+                aState.PauseTiming();
+                auto world = makeWorld(count);
+                aState.ResumeTiming();
+                for (std::size_t idx = 0; idx < count; idx++) {
+                    world->killEntity(idx);
+                }
+                aState.PauseTiming();
+                world.reset();
+                aState.ResumeTiming();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        void addComponentToEntity(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+
+            for (auto iteration : aState) {
+                aState.PauseTiming();
+                auto world = std::make_unique<Engine::Core::World>();
+
+                world->registerComponents<Position, Velocity, Health>();
+                for (std::size_t idx = 0; idx < count; idx++) {
+                    world->createEntity();
+                }
+                aState.ResumeTiming();
+                for (std::size_t idx = 0; idx < count; idx++) {
+                    benchmark::DoNotOptimize(world->addComponentToEntity(idx, Health {static_cast<int>(idx)}));
+                }
+                aState.PauseTiming();
+                world.reset();
+                aState.ResumeTiming();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        /**
+         * @brief Kill then respawn a tenth of the entities each iteration, a wave of enemies
+         */
+        void churn(benchmark::State &aState)
+        {
+            constexpr std::size_t waveRatio = 10;
+            const auto count = static_cast<std::size_t>(aState.range(0));
+            const auto wave = count / waveRatio;
+            auto world = makeWorld(count);
+            std::size_t offset = 0;
+
+            for (auto iteration : aState) {
+                for (std::size_t idx = 0; idx < wave; idx++) {
+                    world->killEntity((offset + idx * waveRatio) % count);
+                }
+                for (std::size_t idx = 0; idx < wave; idx++) {
+                    auto entity = world->createEntity();
+
+                    world->addComponentToEntity(entity, Position {0.0F, 0.0F});
+                    world->addComponentToEntity(entity, Velocity {1.0F, 1.0F});
+                }
+                offset++;
+            }
+            aState.SetItemsProcessed(aState.iterations() * static_cast<std::int64_t>(wave) * 2);
+        }
+
+        /**
+         * @brief Fork the world and move every entity in the fork, a speculative branch writing one storage
+         */
+        void forkAndWrite(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+            auto world = makeWorld(count);
+
+            for (auto iteration : aState) {
+                auto branch = world->fork();
+
+                branch.query<Position>().forEach(0, [](Engine::Core::World & /*world*/, double /*deltaTime*/,
+                                                       std::size_t /*idx*/, Position &aPosition) {
+                    aPosition.x += 1.0F;
+                });
+                benchmark::ClobberMemory();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+    } // namespace
+
+    BENCHMARK(createEntity)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities);
+    BENCHMARK(killEntity)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities);
+    BENCHMARK(addComponentToEntity)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities);
+    BENCHMARK(churn)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities / entitiesMultiplier);
+    BENCHMARK(forkAndWrite)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities);
+} // namespace Benchmarks
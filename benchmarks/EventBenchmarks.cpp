@@ -0,0 +1,135 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Core/Events/EventsManager.hpp"
+
+namespace Benchmarks {
+    namespace {
+        struct HitEvent
+        {
+                std::size_t source;
+                std::size_t target;
+                int damage;
+        };
+
+        struct ChatEvent
+        {
+                std::size_t sender;
+                std::string text;
+        };
+
+        struct ArenaChatEvent
+        {
+                std::size_t sender;
+                std::string_view text;
+        };
+
+        constexpr std::size_t eventsPerIteration = 1'000;
+        const std::string chatText = "a chat message long enough to skip the small string optimization";
+        constexpr int maxThreads = 8;
+
+        /**
+         * @brief Several threads push events at the same time, like a network thread and the game thread
+         */
+        void pushEvent(benchmark::State &aState)
+        {
+            auto &manager = Engine::Event::EventManager::getInstance();
+
+            if (aState.thread_index() == 0) {
+                manager.initEventHandler<HitEvent>();
+            }
+            for (auto iteration : aState) {
+                if (aState.thread_index() == 0) {
+                    manager.keepEventsAndClear<>();
+                }
+                for (std::size_t idx = 0; idx < eventsPerIteration; idx++) {
+                    manager.pushEvent(HitEvent {idx, idx + 1, 1});
+                }
+            }
+            aState.SetItemsProcessed(aState.iterations() * static_cast<std::int64_t>(eventsPerIteration));
+            if (aState.thread_index() == 0) {
+                manager.keepEventsAndClear<>();
+            }
+        }
+
+        /**
+         * @brief Same as pushEvent, but each thread pushes its events in one batch, like the UDP transport
+         */
+        void pushEvents(benchmark::State &aState)
+        {
+            auto &manager = Engine::Event::EventManager::getInstance();
+            std::vector<HitEvent> batch;
+
+            if (aState.thread_index() == 0) {
+                manager.initEventHandler<HitEvent>();
+            }
+            for (std::size_t idx = 0; idx < eventsPerIteration; idx++) {
+                batch.push_back(HitEvent {idx, idx + 1, 1});
+            }
+            for (auto iteration : aState) {
+                if (aState.thread_index() == 0) {
+                    manager.keepEventsAndClear<>();
+                }
+                manager.pushEvents(std::span<const HitEvent>(batch));
+            }
+            aState.SetItemsProcessed(aState.iterations() * static_cast<std::int64_t>(eventsPerIteration));
+            if (aState.thread_index() == 0) {
+                manager.keepEventsAndClear<>();
+            }
+        }
+
+        /**
+         * @brief Push then read events owning a string, a heap allocation per push
+         */
+        void pushOwnedPayloads(benchmark::State &aState)
+        {
+            auto &manager = Engine::Event::EventManager::getInstance();
+            std::size_t length = 0;
+
+            manager.initEventHandler<ChatEvent>();
+            for (auto iteration : aState) {
+                for (std::size_t idx = 0; idx < eventsPerIteration; idx++) {
+                    manager.pushEvent(ChatEvent {idx, chatText});
+                }
+                for (const auto &event : manager.getEventsByType<ChatEvent>()) {
+                    length += event.text.size();
+                }
+                manager.keepEventsAndClear<>();
+            }
+            benchmark::DoNotOptimize(length);
+            aState.SetItemsProcessed(aState.iterations() * static_cast<std::int64_t>(eventsPerIteration));
+        }
+
+        /**
+         * @brief Same as pushOwnedPayloads, the strings are copied into the event arena reset every frame
+         */
+        void pushArenaPayloads(benchmark::State &aState)
+        {
+            auto &manager = Engine::Event::EventManager::getInstance();
+            auto &arena = manager.getArena();
+            std::size_t length = 0;
+
+            manager.initEventHandler<ArenaChatEvent>();
+            for (auto iteration : aState) {
+                for (std::size_t idx = 0; idx < eventsPerIteration; idx++) {
+                    manager.pushEvent(ArenaChatEvent {idx, arena.store(chatText)});
+                }
+                for (const auto &event : manager.getEventsByType<ArenaChatEvent>()) {
+                    length += event.text.size();
+                }
+                manager.keepEventsAndClear<>();
+                arena.reset();
+            }
+            benchmark::DoNotOptimize(length);
+            aState.SetItemsProcessed(aState.iterations() * static_cast<std::int64_t>(eventsPerIteration));
+        }
+    } // namespace
+
+    BENCHMARK(pushEvent)->ThreadRange(1, maxThreads)->UseRealTime();
+    BENCHMARK(pushEvents)->ThreadRange(1, maxThreads)->UseRealTime();
+    BENCHMARK(pushOwnedPayloads);
+    BENCHMARK(pushArenaPayloads);
+} // namespace Benchmarks
@@ -0,0 +1,157 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include "Components.hpp"
+
+namespace Benchmarks {
+    namespace {
+        constexpr std::int64_t sparseOccupancy = 10;
+        constexpr std::int64_t denseOccupancy = 100;
+
+        struct GroupedPosition
+        {
+                float x;
+                float y;
+        };
+
+        struct GroupedVelocity
+        {
+                float dx;
+                float dy;
+        };
+    } // namespace
+} // namespace Benchmarks
+
+template<>
+struct Engine::Core::ComponentStorage<Benchmarks::GroupedPosition>
+{
+        using type = Engine::Core::PackedArray<Benchmarks::GroupedPosition>;
+};
+
+template<>
+struct Engine::Core::ComponentStorage<Benchmarks::GroupedVelocity>
+{
+        using type = Engine::Core::PackedArray<Benchmarks::GroupedVelocity>;
+};
+
+namespace Benchmarks {
+    namespace {
+        /**
+         * @brief Integrate Position with Velocity, range(1) percent of the entities have a Velocity
+         */
+        void queryForEach(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+            auto world = makeWorld(count, static_cast<std::size_t>(aState.range(1)));
+
+            for (auto iteration : aState) {
+                world->query<Position, Velocity>().forEach(
+                    deltaTime, [](Engine::Core::World & /*world*/, double aDeltaTime, std::size_t /*idx*/,
+                                  Position &aPosition, Velocity &aVelocity) {
+                        aPosition.x += aVelocity.dx * static_cast<float>(aDeltaTime);
+                        aPosition.y += aVelocity.dy * static_cast<float>(aDeltaTime);
+                    });
+                benchmark::ClobberMemory();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        void queryForEachParallel(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+            auto world = makeWorld(count, static_cast<std::size_t>(aState.range(1)));
+
+            for (auto iteration : aState) {
+                world->query<Position, Velocity>().forEachParallel(
+                    deltaTime, [](Engine::Core::World & /*world*/, double aDeltaTime, std::size_t /*idx*/,
+                                  Position &aPosition, Velocity &aVelocity) {
+                        aPosition.x += aVelocity.dx * static_cast<float>(aDeltaTime);
+                        aPosition.y += aVelocity.dy * static_cast<float>(aDeltaTime);
+                    });
+                benchmark::ClobberMemory();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        void queryForEachFiltered(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+            auto world = makeWorld(count, static_cast<std::size_t>(aState.range(1)));
+
+            for (auto iteration : aState) {
+                std::size_t matched = 0;
+
+                world->query<Position, Engine::Core::Without<Velocity>>().forEach(
+                    deltaTime, [&matched](Engine::Core::World & /*world*/, double /*deltaTime*/,
+                                          std::size_t /*idx*/, Position & /*position*/) {
+                        matched++;
+                    });
+                benchmark::DoNotOptimize(matched);
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        void cachedQueryForEachFiltered(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+            auto world = makeWorld(count, static_cast<std::size_t>(aState.range(1)));
+            auto query = world->registerQuery<Position, Engine::Core::Without<Velocity>>();
+
+            for (auto iteration : aState) {
+                std::size_t matched = 0;
+
+                query.forEach(deltaTime, [&matched](Engine::Core::World & /*world*/, double /*deltaTime*/,
+                                                    std::size_t /*idx*/, Position & /*position*/) {
+                    matched++;
+                });
+                benchmark::DoNotOptimize(matched);
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        void groupForEach(benchmark::State &aState)
+        {
+            constexpr std::size_t percent = 100;
+            const auto count = static_cast<std::size_t>(aState.range(0));
+            const auto occupancy = static_cast<std::size_t>(aState.range(1));
+            Engine::Core::World world;
+
+            world.registerComponents<GroupedPosition, GroupedVelocity>();
+            auto group = world.registerGroup<GroupedPosition, GroupedVelocity>();
+
+            for (std::size_t idx = 0; idx < count; idx++) {
+                auto entity = world.createEntity();
+
+                world.addComponentToEntity(entity, GroupedPosition {static_cast<float>(idx), 0.0F});
+                if (idx % percent < occupancy) {
+                    world.addComponentToEntity(entity, GroupedVelocity {1.0F, 2.0F});
+                }
+            }
+            for (auto iteration : aState) {
+                group.forEach(deltaTime, [](Engine::Core::World & /*world*/, double aDeltaTime, std::size_t /*idx*/,
+                                            GroupedPosition &aPosition, GroupedVelocity &aVelocity) {
+                    aPosition.x += aVelocity.dx * static_cast<float>(aDeltaTime);
+                    aPosition.y += aVelocity.dy * static_cast<float>(aDeltaTime);
+                });
+                benchmark::ClobberMemory();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+    } // namespace
+
+    BENCHMARK(queryForEach)
+        ->ArgsProduct({benchmark::CreateRange(minEntities, maxEntities, entitiesMultiplier),
+                       {sparseOccupancy, denseOccupancy}});
+    BENCHMARK(queryForEachParallel)
+        ->ArgsProduct({benchmark::CreateRange(minEntities, maxEntities, entitiesMultiplier),
+                       {sparseOccupancy, denseOccupancy}})
+        ->UseRealTime();
+    BENCHMARK(queryForEachFiltered)
+        ->ArgsProduct({benchmark::CreateRange(minEntities, maxEntities, entitiesMultiplier),
+                       {sparseOccupancy, denseOccupancy}});
+    BENCHMARK(cachedQueryForEachFiltered)
+        ->ArgsProduct({benchmark::CreateRange(minEntities, maxEntities, entitiesMultiplier),
+                       {sparseOccupancy, denseOccupancy}});
+    BENCHMARK(groupForEach)
+        ->ArgsProduct({benchmark::CreateRange(minEntities, maxEntities, entitiesMultiplier),
+                       {sparseOccupancy, denseOccupancy}});
+} // namespace Benchmarks
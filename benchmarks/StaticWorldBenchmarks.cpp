@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "Components.hpp"
+
+namespace Benchmarks {
+    namespace {
+        constexpr std::int64_t sparseOccupancy = 10;
+        constexpr std::int64_t denseOccupancy = 100;
+
+        /**
+         * @brief createEntity on a StaticWorld, compare with createEntity
+         */
+        void staticCreateEntity(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+
+            for (auto iteration : aState) {
+                aState.PauseTiming();
+                auto world = std::make_unique<StaticBenchWorld>();
+                aState.ResumeTiming();
+                for (std::size_t idx = 0; idx < count; idx++) {
+                    benchmark::DoNotOptimize(world->createEntity());
+                }
+                aState.PauseTiming();
+                world.reset();
+                aState.ResumeTiming();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        /**
+         * @brief killEntity on a StaticWorld, compare with killEntity
+         */
+        void staticKillEntity(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+
+            for (auto iteration : aState) {
+                aState.PauseTiming();
+                auto world = makeStaticWorld(count);
+                aState.ResumeTiming();
+                for (std::size_t idx = 0; idx < count; idx++) {
+                    world->killEntity(idx);
+                }
+                aState.PauseTiming();
+                world.reset();
+                aState.ResumeTiming();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        /**
+         * @brief addComponentToEntity on a StaticWorld, compare with addComponentToEntity
+         */
+        void staticAddComponentToEntity(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+
+            for (auto iteration : aState) {
+                aState.PauseTiming();
+                auto world = std::make_unique<StaticBenchWorld>();
+
+                for (std::size_t idx = 0; idx < count; idx++) {
+                    world->createEntity();
+                }
+                aState.ResumeTiming();
+                for (std::size_t idx = 0; idx < count; idx++) {
+                    benchmark::DoNotOptimize(world->addComponentToEntity(idx, Health {static_cast<int>(idx)}));
+                }
+                aState.PauseTiming();
+                world.reset();
+                aState.ResumeTiming();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        /**
+         * @brief Integrate Position with Velocity on a StaticWorld, compare with queryForEach
+         */
+        void staticQueryForEach(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+            auto world = makeStaticWorld(count, static_cast<std::size_t>(aState.range(1)));
+
+            for (auto iteration : aState) {
+                world->query<Position, Velocity>().forEach(
+                    deltaTime, [](Engine::Core::World & /*world*/, double aDeltaTime, std::size_t /*idx*/,
+                                  Position &aPosition, Velocity &aVelocity) {
+                        aPosition.x += aVelocity.dx * static_cast<float>(aDeltaTime);
+                        aPosition.y += aVelocity.dy * static_cast<float>(aDeltaTime);
+                    });
+                benchmark::ClobberMemory();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+    } // namespace
+
+    BENCHMARK(staticCreateEntity)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities);
+    BENCHMARK(staticKillEntity)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities);
+    BENCHMARK(staticAddComponentToEntity)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities);
+    BENCHMARK(staticQueryForEach)
+        ->ArgsProduct({benchmark::CreateRange(minEntities, maxEntities, entitiesMultiplier),
+                       {sparseOccupancy, denseOccupancy}});
+} // namespace Benchmarks
@@ -0,0 +1,142 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cstddef>
+#include <span>
+#include "Components.hpp"
+#include "Core/PagedArray.hpp"
+#include "Core/Simd.hpp"
+#include "Core/SparseArray.hpp"
+
+namespace Benchmarks {
+    namespace {
+        struct SoAPosition
+        {
+                float x;
+                float y;
+        };
+
+        struct SoAVelocity
+        {
+                float dx;
+                float dy;
+        };
+
+        struct Blackboard
+        {
+                std::array<float, 64> values;
+        };
+    } // namespace
+} // namespace Benchmarks
+
+template<>
+struct Engine::Core::SoALayout<Benchmarks::SoAPosition>
+{
+        static constexpr auto members = std::make_tuple(&Benchmarks::SoAPosition::x, &Benchmarks::SoAPosition::y);
+};
+
+template<>
+struct Engine::Core::SoALayout<Benchmarks::SoAVelocity>
+{
+        static constexpr auto members =
+            std::make_tuple(&Benchmarks::SoAVelocity::dx, &Benchmarks::SoAVelocity::dy);
+};
+
+namespace Benchmarks {
+    namespace {
+        std::unique_ptr<Engine::Core::World> makeSoAWorld(std::size_t aCount)
+        {
+            auto world = std::make_unique<Engine::Core::World>();
+
+            world->registerComponents<SoAPosition, SoAVelocity>();
+            for (std::size_t idx = 0; idx < aCount; idx++) {
+                auto entity = world->createEntity();
+
+                world->addComponentToEntity(entity, SoAPosition {static_cast<float>(idx), 0.0F});
+                world->addComponentToEntity(entity, SoAVelocity {1.0F, 2.0F});
+            }
+            return world;
+        }
+
+        /**
+         * @brief Movement integration through the SIMD kernels, over whole SoA fields
+         */
+        void integrateSoA(benchmark::State &aState)
+        {
+            auto world = makeSoAWorld(static_cast<std::size_t>(aState.range(0)));
+            auto &positions = world->getComponent<SoAPosition>();
+            auto &velocities = world->getComponent<SoAVelocity>();
+
+            for (auto iteration : aState) {
+                Engine::Simd::integrate(positions.field<0>(), velocities.field<0>(), deltaTime);
+                Engine::Simd::integrate(positions.field<1>(), velocities.field<1>(), deltaTime);
+                benchmark::ClobberMemory();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        /**
+         * @brief Same integration with the scalar kernels, to measure the SIMD gain
+         */
+        void integrateSoAScalar(benchmark::State &aState)
+        {
+            auto world = makeSoAWorld(static_cast<std::size_t>(aState.range(0)));
+            auto &positions = world->getComponent<SoAPosition>();
+            auto &velocities = world->getComponent<SoAVelocity>();
+
+            for (auto iteration : aState) {
+                Engine::Simd::Scalar::integrate(positions.field<0>(), velocities.field<0>(), deltaTime);
+                Engine::Simd::Scalar::integrate(positions.field<1>(), velocities.field<1>(), deltaTime);
+                benchmark::ClobberMemory();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        /**
+         * @brief Same integration over the SoA storage, run by run through forEachBatch
+         */
+        void integrateSoABatch(benchmark::State &aState)
+        {
+            auto world = makeSoAWorld(static_cast<std::size_t>(aState.range(0)));
+            auto &positions = world->getComponent<SoAPosition>();
+            auto &velocities = world->getComponent<SoAVelocity>();
+
+            for (auto iteration : aState) {
+                velocities.forEachBatch([&positions](std::size_t aFirst, std::span<float> aDxs, std::span<float> aDys) {
+                    Engine::Simd::integrate(positions.field<0>().subspan(aFirst, aDxs.size()), aDxs, deltaTime);
+                    Engine::Simd::integrate(positions.field<1>().subspan(aFirst, aDys.size()), aDys, deltaTime);
+                });
+                benchmark::ClobberMemory();
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+
+        /**
+         * @brief A spawn wave of large components: the vector moves all of them each time it grows
+         */
+        template<typename Storage>
+        void spawnWave(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+
+            for (auto iteration : aState) {
+                Storage storage;
+
+                for (std::size_t idx = 0; idx < count; idx++) {
+                    storage.emplace(idx, Blackboard {{static_cast<float>(idx)}});
+                }
+                benchmark::DoNotOptimize(storage.get(count - 1));
+            }
+            aState.SetItemsProcessed(aState.iterations() * aState.range(0));
+        }
+    } // namespace
+
+    BENCHMARK(integrateSoA)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities);
+    BENCHMARK(integrateSoAScalar)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities);
+    BENCHMARK(integrateSoABatch)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities);
+    BENCHMARK(spawnWave<Engine::Core::SparseArray<Blackboard>>)
+        ->RangeMultiplier(entitiesMultiplier)
+        ->Range(minEntities, maxEntities);
+    BENCHMARK(spawnWave<Engine::Core::PagedArray<Blackboard>>)
+        ->RangeMultiplier(entitiesMultiplier)
+        ->Range(minEntities, maxEntities);
+} // namespace Benchmarks
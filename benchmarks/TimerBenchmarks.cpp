@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include "Components.hpp"
+#include "Core/World.hpp"
+
+namespace Benchmarks {
+    namespace {
+        struct Cooldown
+        {
+                std::uint32_t ticksLeft;
+        };
+
+        constexpr std::uint32_t maxDelay = 1'000;
+
+        /**
+         * @brief Each entity has a cooldown decremented every tick by a query, restarted when it expires
+         */
+        void countdownComponents(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+            Engine::Core::World world;
+            std::size_t expired = 0;
+
+            world.registerComponents<Cooldown>();
+            for (std::size_t idx = 0; idx < count; idx++) {
+                world.addComponentToEntity(world.createEntity(),
+                                           Cooldown {static_cast<std::uint32_t>(idx % maxDelay) + 1});
+            }
+            for (auto iteration : aState) {
+                world.query<Cooldown>().forEach(
+                    0, [&expired](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/,
+                                  Cooldown &aCooldown) {
+                        if (--aCooldown.ticksLeft == 0) {
+                            aCooldown.ticksLeft = maxDelay;
+                            expired++;
+                        }
+                    });
+            }
+            benchmark::DoNotOptimize(expired);
+            aState.SetItemsProcessed(aState.iterations());
+        }
+
+        /**
+         * @brief Same cooldowns as countdownComponents, as timers of the World restarted when they fire
+         */
+        void timerWheel(benchmark::State &aState)
+        {
+            const auto count = static_cast<std::size_t>(aState.range(0));
+            Engine::Core::World world;
+            std::size_t expired = 0;
+            Engine::Core::TimerWheel::timerFunc restart = [&expired, &restart](Engine::Core::World &aWorld) {
+                aWorld.addTimer(maxDelay, restart);
+                expired++;
+            };
+
+            for (std::size_t idx = 0; idx < count; idx++) {
+                world.addTimer(world.createEntity(), static_cast<std::uint32_t>(idx % maxDelay) + 1, restart);
+            }
+            for (auto iteration : aState) {
+                world.getTimers().advance(world);
+            }
+            benchmark::DoNotOptimize(expired);
+            aState.SetItemsProcessed(aState.iterations());
+        }
+    } // namespace
+
+    BENCHMARK(countdownComponents)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities);
+    BENCHMARK(timerWheel)->RangeMultiplier(entitiesMultiplier)->Range(minEntities, maxEntities);
+} // namespace Benchmarks
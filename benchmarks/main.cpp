@@ -0,0 +1,14 @@
+#include <benchmark/benchmark.h>
+#include "Core/Simd.hpp"
+
+int main(int argc, char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::AddCustomContext("simd_backend", Engine::Simd::backendName());
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
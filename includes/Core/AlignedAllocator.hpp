@@ -0,0 +1,82 @@
+#ifndef ALIGNEDALLOCATOR_HPP_
+#define ALIGNEDALLOCATOR_HPP_
+
+#include <cstddef>
+#include <new>
+
+namespace Engine::Core {
+
+    /**
+     * @brief Allocator returning memory aligned on a given boundary
+     * @details Used by the SoA storages so each field array starts on a SIMD register / cache line boundary
+     *
+     * @tparam Type The type of the elements to allocate
+     * @tparam Alignment The alignment of the allocations, in bytes
+     */
+    template<typename Type, std::size_t Alignment = 64>
+    class AlignedAllocator
+    {
+        public:
+            using value_type = Type;
+
+            template<typename Other>
+            struct rebind
+            {
+                    using other = AlignedAllocator<Other, Alignment>;
+            };
+
+#pragma region constructors / destructors
+            AlignedAllocator() noexcept = default;
+            ~AlignedAllocator() = default;
+
+            AlignedAllocator(const AlignedAllocator &other) noexcept = default;
+            AlignedAllocator &operator=(const AlignedAllocator &other) noexcept = default;
+
+            AlignedAllocator(AlignedAllocator &&other) noexcept = default;
+            AlignedAllocator &operator=(AlignedAllocator &&other) noexcept = default;
+
+            template<typename Other>
+            explicit AlignedAllocator(const AlignedAllocator<Other, Alignment> & /*other*/) noexcept
+            {}
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            /**
+             * @brief Allocate memory for aCount elements
+             *
+             * @param aCount The number of elements
+             * @return Type* The aligned memory
+             */
+            [[nodiscard]] Type *allocate(std::size_t aCount)
+            {
+                return static_cast<Type *>(::operator new(aCount * sizeof(Type), std::align_val_t {Alignment}));
+            }
+
+            /**
+             * @brief Release memory given by allocate
+             *
+             * @param aPtr The memory to release
+             */
+            void deallocate(Type *aPtr, std::size_t /*aCount*/) noexcept
+            {
+                ::operator delete(aPtr, std::align_val_t {Alignment});
+            }
+#pragma endregion methods
+
+#pragma region operators
+            template<typename Other>
+            bool operator==(const AlignedAllocator<Other, Alignment> & /*other*/) const noexcept
+            {
+                return true;
+            }
+
+            template<typename Other>
+            bool operator!=(const AlignedAllocator<Other, Alignment> & /*other*/) const noexcept
+            {
+                return false;
+            }
+#pragma endregion operators
+    };
+} // namespace Engine::Core
+
+#endif /* !ALIGNEDALLOCATOR_HPP_ */
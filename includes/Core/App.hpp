@@ -1,10 +1,25 @@
 #ifndef APP_HPP_
 #define APP_HPP_
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <future>
 #include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
 #include "Exception.hpp"
+#include "Profiler.hpp"
+#include "JobSystem.hpp"
 #include "World.hpp"
 #include <boost/container/flat_map.hpp>
+#include <boost/container/flat_set.hpp>
 
 namespace Engine {
 
@@ -13,20 +28,82 @@ namespace Engine {
     DEFINE_EXCEPTION_FROM(AppExceptionKeyNotFound, AppException);
     DEFINE_EXCEPTION_FROM(AppExceptionKeyAlreadyExists, AppException);
 
+    /**
+     * @brief What a world running at a fixed tick rate does when it falls behind
+     */
+    enum class OverloadPolicy
+    {
+        CatchUp, ///< Run the missed steps, up to the max catch up steps per tick, the others are dropped
+        Skip,    ///< Run at most one step per tick, the missed steps are dropped
+    };
+
     template<typename Key = std::size_t>
     class App
     {
         public:
             using world = std::unique_ptr<Core::World>;
             using worlds = boost::container::flat_map<Key, world>;
+            using tags = boost::container::flat_set<std::string>;
+            using progressFunc = std::function<void(float)>;
+            using worldBuilder = std::function<void(Core::World &, const progressFunc &)>;
+
+            static constexpr std::size_t defaultMaxCatchUpSteps = 4;
+
+            /**
+             * @brief Statistics of the last call to tick, the durations are in milliseconds
+             * @details The saturation is the time spent running worlds over the time the workers and the ticking thread
+             * had, close to 1 the host can't keep up, any dropped step means a world ran slower than its tick rate
+             */
+            struct TickStats
+            {
+                    std::size_t worlds = 0;
+                    std::size_t steps = 0;
+                    std::size_t droppedSteps = 0;
+                    double wallTime = 0;
+                    double busyTime = 0;
+                    double saturation = 0;
+            };
+
+        protected:
+            /**
+             * @brief How a world is ticked, a rate of 0 runs its systems once per tick
+             */
+            struct WorldTick
+            {
+                    double rate = 0;
+                    double accumulator = 0;
+                    tags worldTags;
+            };
+
+            /**
+             * @brief A world being built on a background thread
+             */
+            struct WorldLoad
+            {
+                    std::future<world> result;
+                    std::shared_ptr<std::atomic<float>> progress;
+            };
 
         private:
             worlds _worlds;
-            Key _currentWorld;
+            Key _currentWorld {};
+            boost::container::flat_map<Key, WorldLoad> _loads;
+            std::optional<std::pair<Key, bool>> _pendingSwitch;
+            std::vector<std::future<void>> _retired;
+            boost::container::flat_map<Key, WorldTick> _ticks;
+            std::reference_wrapper<Core::JobSystem> _jobs {Core::JobSystem::getInstance()};
+            OverloadPolicy _policy = OverloadPolicy::CatchUp;
+            std::size_t _maxCatchUpSteps = defaultMaxCatchUpSteps;
+            TickStats _tickStats;
+            Profiler _tickProfiler;
 
         public:
 #pragma region constructors / destructors
-            App() = default;
+            App()
+            {
+                _tickProfiler.setMaxTraceEvents(0);
+            }
+
             ~App() = default;
 
             App(const App &other) = delete;
@@ -52,11 +129,11 @@ namespace Engine {
              *
              * @param key The key of the world
              * @param aWorld The world to add
-             * @throw AppExceptionKeyAlreadyExists If the key already exists
+             * @throw AppExceptionKeyAlreadyExists If the key already exists or is already loading
              */
             world &addWorld(const Key &aKey, world &&aWorld)
             {
-                if (_worlds.find(aKey) != _worlds.end()) {
+                if (_worlds.find(aKey) != _worlds.end() || _loads.find(aKey) != _loads.end()) {
                     throw AppExceptionKeyAlreadyExists("The key already exists");
                 }
                 _worlds[aKey] = std::move(aWorld);
@@ -67,17 +144,119 @@ namespace Engine {
              * @brief Add a level to the app
              *
              * @param key The key of the world
-             * @throw AppExceptionKeyAlreadyExists If the key already exists
+             * @throw AppExceptionKeyAlreadyExists If the key already exists or is already loading
              */
             world &addWorld(const Key &aKey)
             {
-                if (_worlds.find(aKey) != _worlds.end()) {
+                if (_worlds.find(aKey) != _worlds.end() || _loads.find(aKey) != _loads.end()) {
                     throw AppExceptionKeyAlreadyExists("The key already exists");
                 }
                 _worlds[aKey] = std::make_unique<Core::World>();
                 return _worlds[aKey];
             }
 
+            /**
+             * @brief Build a world on a background thread, it is added by the first syncWorlds after the builder returns
+             * @details The builder gets the new world and a function to report its progress, between 0 and 1
+             *
+             * @param aKey The key of the world
+             * @param aBuilder The function populating the world
+             * @throw AppExceptionKeyAlreadyExists If the key already exists or is already loading
+             */
+            void loadWorldAsync(const Key &aKey, worldBuilder aBuilder)
+            {
+                if (_worlds.find(aKey) != _worlds.end() || _loads.find(aKey) != _loads.end()) {
+                    throw AppExceptionKeyAlreadyExists("The key already exists");
+                }
+                auto progress = std::make_shared<std::atomic<float>>(0);
+                auto result = std::async(std::launch::async, [builder = std::move(aBuilder), progress]() {
+                    auto newWorld = std::make_unique<Core::World>();
+
+                    builder(*newWorld, [&progress](float aProgress) {
+                        progress->store(std::clamp(aProgress, 0.0F, 1.0F));
+                    });
+                    progress->store(1);
+                    return newWorld;
+                });
+
+                _loads.emplace(aKey, WorldLoad {std::move(result), std::move(progress)});
+            }
+
+            /**
+             * @brief Get the progress of a world loaded by loadWorldAsync
+             *
+             * @param aKey The key of the world
+             * @throw AppExceptionKeyNotFound If the key doesn't exist and isn't loading
+             * @return float The last progress reported by the builder, 1 once the world is added
+             */
+            [[nodiscard]] float getLoadProgress(const Key &aKey) const
+            {
+                if (_worlds.find(aKey) != _worlds.end()) {
+                    return 1;
+                }
+                const auto load = _loads.find(aKey);
+
+                if (load == _loads.end()) {
+                    throw AppExceptionKeyNotFound("The key doesn't exist");
+                }
+                return load->second.progress->load();
+            }
+
+            /**
+             * @brief Add the worlds done loading, apply the current world switch requested during the load and forget
+             * the worlds destroyed in the background
+             * @details Called at the start of every tick, call it at the frame boundary when the worlds are run by
+             * hand
+             * @throw The exception thrown by the builder of a world, the world is not added
+             */
+            void syncWorlds()
+            {
+                for (auto load = _loads.begin(); load != _loads.end();) {
+                    if (load->second.result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                        load++;
+                        continue;
+                    }
+                    const auto key = load->first;
+                    auto result = std::move(load->second.result);
+
+                    load = _loads.erase(load);
+                    _worlds[key] = result.get();
+                }
+                if (_pendingSwitch && _worlds.find(_pendingSwitch->first) != _worlds.end()) {
+                    const auto [key, removePrevious] = *std::exchange(_pendingSwitch, std::nullopt);
+                    const auto previous = std::exchange(_currentWorld, key);
+
+                    if (removePrevious && previous != key && _worlds.find(previous) != _worlds.end()) {
+                        removeWorldAsync(previous);
+                    }
+                }
+                std::erase_if(_retired, [](const std::future<void> &aRetired) {
+                    return aRetired.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+                });
+            }
+
+            /**
+             * @brief Remove the world at the given key and destroy it on a background thread
+             *
+             * @param aKey The key of the world to remove
+             * @throw AppExceptionKeyNotFound If the key doesn't exist
+             */
+            void removeWorldAsync(const Key &aKey)
+            {
+                const auto found = _worlds.find(aKey);
+
+                if (found == _worlds.end()) {
+                    throw AppExceptionKeyNotFound("The key doesn't exist");
+                }
+                auto old = std::move(found->second);
+
+                _worlds.erase(found);
+                _ticks.erase(aKey);
+                _retired.push_back(std::async(std::launch::async, [old = std::move(old)]() mutable {
+                    old.reset();
+                }));
+            }
+
             /**
              * @brief Remove the world at the given key
              *
@@ -90,6 +269,7 @@ namespace Engine {
                     throw AppExceptionKeyNotFound("The key doesn't exist");
                 }
                 _worlds.erase(aKey);
+                _ticks.erase(aKey);
             }
 
             /**
@@ -121,17 +301,241 @@ namespace Engine {
 
             /**
              * @brief Set the current world
-             * @throw AppExceptionKeyNotFound If the key doesn't exist
+             * @details A world still loading becomes current at the first syncWorlds after its load
+             * @throw AppExceptionKeyNotFound If the key doesn't exist and isn't loading
              * @param index The index of the world to set as current
+             * @param aRemovePrevious Whether the previous current world is removed and destroyed in the background
              */
-            void setCurrentWorld(const Key &key)
+            void setCurrentWorld(const Key &key, bool aRemovePrevious = false)
             {
+                if (_loads.find(key) != _loads.end()) {
+                    _pendingSwitch = std::make_pair(key, aRemovePrevious);
+                    return;
+                }
                 if (_worlds.find(key) == _worlds.end()) {
                     throw AppExceptionKeyNotFound("The key doesn't exist");
                 }
+                _pendingSwitch.reset();
+                if (aRemovePrevious && _currentWorld != key && _worlds.find(_currentWorld) != _worlds.end()) {
+                    removeWorldAsync(_currentWorld);
+                }
                 _currentWorld = key;
             }
+
+            /**
+             * @brief Set how often the systems of a world run
+             * @throw AppExceptionKeyNotFound If the key doesn't exist
+             * @param aKey The key of the world
+             * @param aRate The number of steps per second, 0 to run once per tick
+             */
+            void setTickRate(const Key &aKey, double aRate)
+            {
+                getTick(aKey).rate = std::max(aRate, 0.0);
+            }
+
+            /**
+             * @brief Tag a world, tick can run only the worlds of a tag
+             * @throw AppExceptionKeyNotFound If the key doesn't exist
+             * @param aKey The key of the world
+             * @param aTag The tag
+             */
+            void addWorldTag(const Key &aKey, const std::string &aTag)
+            {
+                getTick(aKey).worldTags.insert(aTag);
+            }
+
+            /**
+             * @brief Remove a tag from a world
+             * @throw AppExceptionKeyNotFound If the key doesn't exist
+             * @param aKey The key of the world
+             * @param aTag The tag
+             */
+            void removeWorldTag(const Key &aKey, const std::string &aTag)
+            {
+                getTick(aKey).worldTags.erase(aTag);
+            }
+
+            /**
+             * @brief Set what the worlds running at a fixed tick rate do when they fall behind
+             *
+             * @param aPolicy The policy
+             * @param aMaxCatchUpSteps The maximum number of steps a world runs per tick with OverloadPolicy::CatchUp
+             */
+            void setOverloadPolicy(OverloadPolicy aPolicy, std::size_t aMaxCatchUpSteps = defaultMaxCatchUpSteps)
+            {
+                _policy = aPolicy;
+                _maxCatchUpSteps = std::max<std::size_t>(aMaxCatchUpSteps, 1);
+            }
+
+            /**
+             * @brief Set the job system ticking the worlds, the engine one by default
+             *
+             * @param aJobs The job system, it must outlive the app
+             */
+            void setJobSystem(Core::JobSystem &aJobs)
+            {
+                _jobs = aJobs;
+            }
+
+            /**
+             * @brief Run the systems of every world concurrently on the job system, each world in a single job
+             * @details A world with a tick rate runs as many steps as the elapsed time allows, following the overload
+             * policy, each step advancing the scripts of the world by its period. The worlds the most behind are
+             * started first. syncWorlds is called first.
+             * @throw The first exception thrown by a system
+             * @param aDeltaTime The time elapsed since the last tick, in seconds
+             */
+            void tick(double aDeltaTime)
+            {
+                tickWorlds(aDeltaTime, [](const WorldTick & /*tick*/) {
+                    return true;
+                });
+            }
+
+            /**
+             * @brief Run the systems of the worlds with the given tag concurrently, see tick
+             * @throw The first exception thrown by a system
+             * @param aDeltaTime The time elapsed since the last tick of these worlds, in seconds
+             * @param aTag The tag
+             */
+            void tick(double aDeltaTime, const std::string &aTag)
+            {
+                tickWorlds(aDeltaTime, [&aTag](const WorldTick &aTick) {
+                    return aTick.worldTags.contains(aTag);
+                });
+            }
+
+            /**
+             * @brief Get the statistics of the last tick
+             *
+             * @return const TickStats& The statistics
+             */
+            [[nodiscard]] const TickStats &getTickStats() const
+            {
+                return _tickStats;
+            }
+
+            /**
+             * @brief Get the duration statistics of the last ticks
+             *
+             * @return Profiler::Stats The statistics, in milliseconds
+             */
+            [[nodiscard]] Profiler::Stats getTickDurationStats() const
+            {
+                return _tickProfiler.getFrameStats();
+            }
+
+            /**
+             * @brief Get the frame duration statistics of the current world
+             * @throw AppExceptionKeyNotFound If the current world doesn't exist
+             * @return Profiler::Stats The statistics of the last frames, in milliseconds
+             */
+            [[nodiscard]] Profiler::Stats getFrameStats() const
+            {
+                return getCurrentWorld()->getProfiler().getFrameStats();
+            }
+
+            /**
+             * @brief Get the update duration statistics of a system of the current world
+             * @throw AppExceptionKeyNotFound If the current world doesn't exist
+             * @param aName The name of the system
+             * @return Profiler::Stats The statistics of the last updates, in milliseconds
+             */
+            [[nodiscard]] Profiler::Stats getSystemStats(const std::string &aName) const
+            {
+                return getCurrentWorld()->getProfiler().getSystemStats(aName);
+            }
+
+            /**
+             * @brief Write the trace of the current world in the Chrome trace event JSON format
+             * @throw AppExceptionKeyNotFound If the current world doesn't exist
+             * @param aStream The stream to write to
+             */
+            void exportChromeTrace(std::ostream &aStream) const
+            {
+                getCurrentWorld()->getProfiler().exportChromeTrace(aStream);
+            }
 #pragma endregion methods
+
+        private:
+            WorldTick &getTick(const Key &aKey)
+            {
+                if (_worlds.find(aKey) == _worlds.end()) {
+                    throw AppExceptionKeyNotFound("The key doesn't exist");
+                }
+                return _ticks[aKey];
+            }
+
+            template<typename Filter>
+            void tickWorlds(double aDeltaTime, Filter &&aFilter)
+            {
+                syncWorlds();
+                struct WorldJob
+                {
+                        Core::World *world;
+                        std::size_t steps;
+                        double lag;
+                        double stepTime;
+                };
+                std::vector<WorldJob> jobs;
+                TickStats stats;
+
+                for (auto &[key, current] : _worlds) {
+                    auto &tick = _ticks[key];
+
+                    if (current == nullptr || !aFilter(tick)) {
+                        continue;
+                    }
+                    if (tick.rate == 0) {
+                        jobs.push_back(WorldJob {current.get(), 1, 0, aDeltaTime});
+                        continue;
+                    }
+                    const double period = 1 / tick.rate;
+
+                    tick.accumulator += aDeltaTime;
+                    const double lag = tick.accumulator / period;
+                    const auto due = static_cast<std::size_t>(std::floor(lag));
+                    const auto allowed = std::min(due, _policy == OverloadPolicy::CatchUp ? _maxCatchUpSteps : 1);
+
+                    tick.accumulator -= static_cast<double>(due) * period;
+                    stats.droppedSteps += due - allowed;
+                    if (allowed > 0) {
+                        jobs.push_back(WorldJob {current.get(), allowed, lag, period});
+                    }
+                }
+                std::stable_sort(jobs.begin(), jobs.end(), [](const WorldJob &aFirst, const WorldJob &aSecond) {
+                    return aFirst.lag > aSecond.lag;
+                });
+                std::vector<double> busy(jobs.size(), 0);
+                const auto start = Profiler::clock::now();
+                Core::JobCounter counter;
+
+                _tickProfiler.beginFrame();
+                for (std::size_t idx = 0; idx < jobs.size(); idx++) {
+                    _jobs.get().submit(
+                        [&job = jobs[idx], &time = busy[idx]]() {
+                            const auto jobStart = Profiler::clock::now();
+
+                            for (std::size_t step = 0; step < job.steps; step++) {
+                                job.world->runSystems(job.stepTime);
+                            }
+                            time = std::chrono::duration<double, std::milli>(Profiler::clock::now() - jobStart).count();
+                        },
+                        counter);
+                }
+                _jobs.get().wait(counter);
+                _tickProfiler.endFrame();
+                stats.worlds = jobs.size();
+                for (std::size_t idx = 0; idx < jobs.size(); idx++) {
+                    stats.steps += jobs[idx].steps;
+                    stats.busyTime += busy[idx];
+                }
+                stats.wallTime = std::chrono::duration<double, std::milli>(Profiler::clock::now() - start).count();
+                if (stats.wallTime > 0) {
+                    stats.saturation = stats.busyTime / (stats.wallTime * static_cast<double>(_jobs.get().size() + 1));
+                }
+                _tickStats = stats;
+            }
     };
 } // namespace Engine
 
@@ -0,0 +1,53 @@
+#ifndef COMPONENTSTORAGE_HPP_
+#define COMPONENTSTORAGE_HPP_
+
+#include <type_traits>
+#include "DoubleBufferedArray.hpp"
+#include "PackedArray.hpp"
+#include "PagedArray.hpp"
+#include "SoAArray.hpp"
+#include "SparseArray.hpp"
+#include "TagArray.hpp"
+
+namespace Engine::Core {
+
+    /**
+     * @brief Select the container used by the World to store a component type
+     * @details Defaults to SparseArray, components with a SoALayout specialization are stored as a SoAArray and
+     * empty components (tags) as a TagArray.
+     * Specialize it to force another storage for a given component, e.g. a PagedArray for the large ones whose
+     * references must survive spawns, a DoubleBufferedArray for the ones read by parallel systems while written, or
+     * a PackedArray for the grouped ones:
+     * @code
+     * template<>
+     * struct Engine::Core::ComponentStorage<Transform>
+     * {
+     *         using type = Engine::Core::PackedArray<Transform>;
+     * };
+     * @endcode
+     *
+     * @tparam Component The type of the component
+     */
+    template<typename Component, typename = void>
+    struct ComponentStorage
+    {
+            using type = SparseArray<Component>;
+    };
+
+    template<typename Component>
+    struct ComponentStorage<Component, std::void_t<decltype(SoALayout<Component>::members)>>
+    {
+            using type = SoAArray<Component>;
+    };
+
+    template<typename Component>
+    struct ComponentStorage<Component, std::enable_if_t<std::is_empty_v<Component>>>
+    {
+            using type = TagArray<Component>;
+    };
+
+    template<typename Component>
+    using StorageOf = typename ComponentStorage<Component>::type;
+} // namespace Engine::Core
+
+#endif /* !COMPONENTSTORAGE_HPP_ */
@@ -3,8 +3,27 @@
 
 #include "App.hpp"
 #include "Clock.hpp"
+#include "ComponentStorage.hpp"
+#include "DoubleBufferedArray.hpp"
+#include "EntityIndex.hpp"
+#include "Expected.hpp"
+#include "JobSystem.hpp"
+#include "MemoryStats.hpp"
+#include "PackedArray.hpp"
+#include "PagedArray.hpp"
+#include "Profiler.hpp"
+#include "QueryFilters.hpp"
+#include "Resources.hpp"
+#include "Script.hpp"
+#include "Simd.hpp"
+#include "SoAArray.hpp"
 #include "SparseArray.hpp"
+#include "StateHash.hpp"
+#include "StaticWorld.hpp"
 #include "Systems/GenericSystem.hpp"
 #include "Systems/System.hpp"
+#include "TagArray.hpp"
+#include "TimerWheel.hpp"
+#include "WorkStealingDeque.hpp"
 #include "World.hpp"
 #endif /* !CORE_HPP_ */
@@ -0,0 +1,366 @@
+#ifndef DOUBLEBUFFEREDARRAY_HPP_
+#define DOUBLEBUFFEREDARRAY_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "MemoryStats.hpp"
+#include "SparseArray.hpp"
+
+namespace Engine::Core {
+
+    /**
+     * @brief DoubleBufferedArray stores ONE component type twice: the state of the previous tick, read-only, and the
+     * state being written for the next one
+     * @details The accessors of SparseArray work on the next state and flag the slots handed out for writing. The
+     * previous state is read with getPrevious, or the Previous<...> query term, so parallel systems can read any
+     * entity while each one writes its own, without locks. At the tick boundary (World::swapBuffers, called by
+     * runSystems) only the flagged slots are copied to the previous state.
+     * Adding, erasing or relocating a component applies to both states at once.
+     * Select it by specializing ComponentStorage:
+     * @code
+     * template<>
+     * struct Engine::Core::ComponentStorage<Position>
+     * {
+     *         using type = Engine::Core::DoubleBufferedArray<Position>;
+     * };
+     * @endcode
+     *
+     * @tparam Component The type of the components to store, copy assignable
+     */
+    template<typename Component>
+    class DoubleBufferedArray final
+    {
+        public:
+            using compRef = Component &;
+            using constCompRef = const Component &;
+            using vectIndex = std::size_t;
+
+        private:
+            SparseArray<Component> _previous;
+            SparseArray<Component> _next;
+            std::vector<std::uint8_t> _dirty;
+
+        public:
+#pragma region constructors / destructors
+            DoubleBufferedArray() = default;
+            ~DoubleBufferedArray() = default;
+
+            DoubleBufferedArray(const DoubleBufferedArray &other) = default;
+            DoubleBufferedArray &operator=(const DoubleBufferedArray &other) = default;
+
+            DoubleBufferedArray(DoubleBufferedArray &&other) noexcept = default;
+            DoubleBufferedArray &operator=(DoubleBufferedArray &&other) noexcept = default;
+#pragma endregion constructors / destructors
+
+#pragma region operators
+            /**
+             * @brief Get the next state of the component at the given index, flagged as written
+             * @throw SparseArrayExceptionOutOfRange if the index is out of range
+             * @throw SparseArrayExceptionEmpty if the component is empty
+             * @param aIndex The index to get
+             * @return compRef The component at the given index
+             */
+            compRef operator[](vectIndex aIndex)
+            {
+                return get(aIndex);
+            }
+
+            constCompRef operator[](vectIndex aIndex) const
+            {
+                return get(aIndex);
+            }
+#pragma endregion operators
+
+#pragma region methods
+            /**
+             * @brief Get the next state of the component at the given index, flagged as written
+             * @throw SparseArrayExceptionOutOfRange if the index is out of range
+             * @throw SparseArrayExceptionEmpty if the component is empty
+             * @param aIndex The index to get
+             * @return compRef The component at the given index
+             */
+            compRef get(vectIndex aIndex)
+            {
+                auto &component = _next.get(aIndex);
+
+                _dirty[aIndex] = 1;
+                return component;
+            }
+
+            constCompRef get(vectIndex aIndex) const
+            {
+                return _next.get(aIndex);
+            }
+
+            /**
+             * @brief Get the next state of the component of the given entity without throwing, flagged as written
+             * @param aIndex The entity
+             * @return Component * The component, nullptr if the index is out of range or empty
+             */
+            Component *tryGet(vectIndex aIndex)
+            {
+                auto *component = _next.tryGet(aIndex);
+
+                if (component != nullptr) {
+                    _dirty[aIndex] = 1;
+                }
+                return component;
+            }
+
+            [[nodiscard]] const Component *tryGet(vectIndex aIndex) const
+            {
+                return _next.tryGet(aIndex);
+            }
+
+            /**
+             * @brief Get the next state of the component of the given entity, flagged as written, only checked by an
+             * assertion in debug builds
+             * @param aIndex The entity
+             * @return compRef The component of the entity
+             */
+            compRef getUnchecked(vectIndex aIndex)
+            {
+                _dirty[aIndex] = 1;
+                return _next.getUnchecked(aIndex);
+            }
+
+            constCompRef getUnchecked(vectIndex aIndex) const
+            {
+                return _next.getUnchecked(aIndex);
+            }
+
+            /**
+             * @brief Get the component at the given index as it was at the last tick boundary
+             * @throw SparseArrayExceptionOutOfRange if the index is out of range
+             * @throw SparseArrayExceptionEmpty if the component is empty
+             * @param aIndex The index to get
+             * @return constCompRef The previous state of the component
+             */
+            [[nodiscard]] constCompRef getPrevious(vectIndex aIndex) const
+            {
+                return _previous.get(aIndex);
+            }
+
+            /**
+             * @brief Get the previous state of the component of the given entity without throwing
+             * @param aIndex The entity
+             * @return const Component * The component, nullptr if the index is out of range or empty
+             */
+            [[nodiscard]] const Component *tryGetPrevious(vectIndex aIndex) const
+            {
+                return _previous.tryGet(aIndex);
+            }
+
+            /**
+             * @brief Get the previous state of the component of the given entity, only checked by an assertion in
+             * debug builds
+             * @param aIndex The entity
+             * @return constCompRef The previous state of the component
+             */
+            [[nodiscard]] constCompRef getPreviousUnchecked(vectIndex aIndex) const
+            {
+                return _previous.getUnchecked(aIndex);
+            }
+
+            /**
+             * @brief Set the component at the given index, in both states
+             * @throw SparseArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The index to set
+             * @param aValue The value to set
+             */
+            void set(vectIndex aIndex, Component &&aValue)
+            {
+                _previous.set(aIndex, Component(aValue));
+                _next.set(aIndex, std::move(aValue));
+                _dirty[aIndex] = 0;
+            }
+
+            /**
+             * @brief Check if the component at the given index is set
+             * @throw SparseArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The index to check
+             * @return true if the component is set
+             * @return false if the component is not set
+             */
+            [[nodiscard]] bool has(vectIndex aIndex) const
+            {
+                return _next.has(aIndex);
+            }
+
+            /**
+             * @brief Check if the component at the given index is set, without throwing
+             * @param aIndex The index to check
+             * @return true if the component is set
+             * @return false if the component is not set or the index is out of range
+             */
+            [[nodiscard]] bool contains(vectIndex aIndex) const
+            {
+                return _next.contains(aIndex);
+            }
+
+            /**
+             * @brief Init the component at the given index, will grow the array if needed and erase the component
+             * @param aIndex The index to init
+             */
+            void init(vectIndex aIndex)
+            {
+                _previous.init(aIndex);
+                _next.init(aIndex);
+                if (aIndex >= _dirty.size()) {
+                    _dirty.resize(aIndex + 1, 0);
+                }
+                _dirty[aIndex] = 0;
+            }
+
+            /**
+             * @brief Build the component at the given index, in both states so it is readable right away
+             * @param aIndex The index to set
+             * @param aArgs The arguments used to build the component
+             * @return compRef The next state of the component
+             */
+            template<typename... Args>
+            compRef emplace(vectIndex aIndex, Args &&...aArgs)
+            {
+                const auto &previous = _previous.emplace(aIndex, std::forward<Args>(aArgs)...);
+
+                if (aIndex >= _dirty.size()) {
+                    _dirty.resize(aIndex + 1, 0);
+                }
+                _dirty[aIndex] = 0;
+                return _next.emplace(aIndex, previous);
+            }
+
+            /**
+             * @brief Erase the component at the given index, in both states
+             * @throw SparseArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The index to erase
+             */
+            void erase(vectIndex aIndex)
+            {
+                _previous.erase(aIndex);
+                _next.erase(aIndex);
+                _dirty[aIndex] = 0;
+            }
+
+            /**
+             * @brief Clear both states
+             */
+            void clear()
+            {
+                _previous.clear();
+                _next.clear();
+                _dirty.clear();
+            }
+
+            /**
+             * @brief Move the component of an index to another one, in both states, the first index becomes empty
+             * @param aFrom The index to move from
+             * @param aTo The index to move to
+             */
+            void relocate(vectIndex aFrom, vectIndex aTo)
+            {
+                if (aFrom >= _dirty.size() || aFrom == aTo) {
+                    return;
+                }
+                _previous.relocate(aFrom, aTo);
+                _next.relocate(aFrom, aTo);
+                if (aTo >= _dirty.size()) {
+                    _dirty.resize(aTo + 1, 0);
+                }
+                _dirty[aTo] = std::exchange(_dirty[aFrom], 0);
+            }
+
+            /**
+             * @brief Copy the slots written since the last call to the previous state, which is then the state of the
+             * tick that just ended
+             * @details Not thread safe, call it between two ticks
+             * @return std::size_t The number of slots copied
+             */
+            std::size_t swap()
+            {
+                std::size_t copied = 0;
+
+                for (vectIndex idx = 0; idx < _dirty.size(); idx++) {
+                    if (_dirty[idx] == 0) {
+                        continue;
+                    }
+                    _dirty[idx] = 0;
+                    if (auto *next = _next.tryGet(idx); next != nullptr) {
+                        _previous.getUnchecked(idx) = *next;
+                        copied++;
+                    }
+                }
+                return copied;
+            }
+
+            /**
+             * @brief Remove the trailing empty slots, never below aSize
+             * @param aSize The minimum size to keep
+             */
+            void shrinkToFit(vectIndex aSize)
+            {
+                _previous.shrinkToFit(aSize);
+                _next.shrinkToFit(aSize);
+                _dirty.resize(_next.size());
+                _dirty.shrink_to_fit();
+            }
+
+            /**
+             * @brief Remove all the trailing empty slots
+             * @return vectIndex The new size
+             */
+            vectIndex compact()
+            {
+                shrinkToFit(0);
+                return _next.size();
+            }
+
+            /**
+             * @brief Get the memory used by the array
+             * @return MemoryStats The memory used, both states and the written flags
+             */
+            [[nodiscard]] MemoryStats memoryStats() const
+            {
+                auto stats = _next.memoryStats();
+                const auto previous = _previous.memoryStats();
+
+                stats.bytesReserved += previous.bytesReserved + _dirty.capacity();
+                stats.bytesLive += previous.bytesLive;
+                return stats;
+            }
+
+            /**
+             * @brief Get the version of the set of filled slots, changed by each call adding or removing a component
+             * @details Lets the World notice the components added or removed through the storage instead of its own
+             * API
+             * @return std::uint64_t The version
+             */
+            [[nodiscard]] std::uint64_t presenceVersion() const
+            {
+                return _next.presenceVersion();
+            }
+
+            /**
+             * @brief Get the number of slots, the last entity initialized + 1
+             *
+             * @return vectIndex The number of slots
+             */
+            [[nodiscard]] vectIndex size() const
+            {
+                return _next.size();
+            }
+#pragma endregion methods
+    };
+
+    template<typename Storage>
+    inline constexpr bool isDoubleBuffered = false;
+
+    template<typename Component>
+    inline constexpr bool isDoubleBuffered<DoubleBufferedArray<Component>> = true;
+} // namespace Engine::Core
+
+#endif /* !DOUBLEBUFFEREDARRAY_HPP_ */
@@ -0,0 +1,110 @@
+#ifndef ENTITYINDEX_HPP_
+#define ENTITYINDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include "Exception.hpp"
+
+namespace Engine::Core {
+
+    DEFINE_EXCEPTION(EntityIndexException);
+    DEFINE_EXCEPTION_FROM(EntityIndexExceptionAlreadyBound, EntityIndexException);
+
+    /**
+     * @brief Map between the external ids of the entities (e.g. 64-bit ids assigned by a server) and the World ids
+     * @details The external ids go through a hash map, so they can be anywhere in the 64-bit range while the World
+     * keeps reusing its small dense ids: the memory depends on the number of live entities, not on the id range.
+     */
+    class EntityIndex
+    {
+        public:
+            using externalId = std::uint64_t;
+
+            static constexpr std::size_t nullId = std::numeric_limits<std::size_t>::max();
+            static constexpr externalId noExternalId = std::numeric_limits<externalId>::max();
+
+        private:
+            std::unordered_map<externalId, std::size_t> _locals;
+            std::vector<externalId> _externals;
+
+        public:
+#pragma region constructors / destructors
+            EntityIndex() = default;
+            ~EntityIndex() = default;
+
+            EntityIndex(const EntityIndex &other) = default;
+            EntityIndex &operator=(const EntityIndex &other) = default;
+
+            EntityIndex(EntityIndex &&other) noexcept = default;
+            EntityIndex &operator=(EntityIndex &&other) noexcept = default;
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            /**
+             * @brief Bind an external id to an entity
+             *
+             * @param aExternal The external id, anything but noExternalId
+             * @param aLocal The entity
+             * @throw EntityIndexExceptionAlreadyBound If the external id or the entity is already bound
+             */
+            void bind(externalId aExternal, std::size_t aLocal);
+
+            /**
+             * @brief Forget the external id of an entity, nothing happens if it has none
+             *
+             * @param aLocal The entity
+             */
+            void unbind(std::size_t aLocal);
+
+            /**
+             * @brief Get the entity bound to an external id
+             *
+             * @param aExternal The external id
+             * @return std::size_t The entity, nullId if none
+             */
+            [[nodiscard]] std::size_t find(externalId aExternal) const;
+
+            /**
+             * @brief Get the external id of an entity
+             *
+             * @param aLocal The entity
+             * @return externalId The external id, noExternalId if none
+             */
+            [[nodiscard]] externalId externalOf(std::size_t aLocal) const;
+
+            /**
+             * @brief Move the bindings to the new ids of the entities, e.g. after a defragmentation
+             *
+             * @param aRemap The new id of each old id, nullId for the dead ones
+             */
+            void remap(std::span<const std::size_t> aRemap);
+
+            /**
+             * @brief Release the memory left by the unbound entities past a size
+             *
+             * @param aSize The number of entities to keep
+             */
+            void shrinkToFit(std::size_t aSize);
+
+            /**
+             * @brief Get the number of bound entities
+             *
+             * @return std::size_t The number of bindings
+             */
+            [[nodiscard]] std::size_t size() const;
+
+            /**
+             * @brief Get an estimate of the memory reserved by the index
+             *
+             * @return std::size_t The number of bytes
+             */
+            [[nodiscard]] std::size_t bytesReserved() const;
+#pragma endregion methods
+    };
+} // namespace Engine::Core
+
+#endif /* !ENTITYINDEX_HPP_ */
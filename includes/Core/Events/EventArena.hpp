@@ -0,0 +1,120 @@
+#ifndef EVENTARENA_HPP_
+#define EVENTARENA_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace Engine::Event {
+
+    /**
+     * @brief Bump allocator for the variable-size payloads of the events, reset once per frame
+     * @details Events hold views (std::string_view, std::span) on bytes copied into the arena instead of owning
+     * strings or vectors: pushing them doesn't allocate and the consumers read the payloads in place. The chunks are
+     * kept by reset, so a steady load stops allocating after the first frames. The views stay valid until the next
+     * reset, the events holding them must be cleared first.
+     */
+    class EventArena
+    {
+        public:
+            static constexpr std::size_t defaultChunkSize = 64 * 1024;
+
+        private:
+            struct Chunk
+            {
+                    std::unique_ptr<std::byte[]> data;
+                    std::size_t size;
+            };
+
+            std::size_t _chunkSize;
+            std::vector<Chunk> _chunks;
+            std::size_t _chunk = 0;
+            std::size_t _offset = 0;
+            std::size_t _used = 0;
+            mutable std::mutex _mutex;
+
+        public:
+#pragma region constructors / destructors
+            /**
+             * @brief Create an empty arena, the first chunk is allocated by the first allocation
+             *
+             * @param aChunkSize The size of a chunk, the larger payloads get a chunk of their own
+             */
+            explicit EventArena(std::size_t aChunkSize = defaultChunkSize);
+            ~EventArena() = default;
+
+            EventArena(const EventArena &other) = delete;
+            EventArena &operator=(const EventArena &other) = delete;
+
+            EventArena(EventArena &&other) noexcept = delete;
+            EventArena &operator=(EventArena &&other) noexcept = delete;
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            /**
+             * @brief Allocate uninitialized bytes, valid until the next reset
+             * @details Can wait for the mutex to be unlocked
+             *
+             * @param aSize The number of bytes
+             * @param aAlignment The alignment, a power of two
+             * @return void* The bytes
+             */
+            void *allocate(std::size_t aSize, std::size_t aAlignment = alignof(std::max_align_t));
+
+            /**
+             * @brief Copy a string into the arena
+             *
+             * @param aText The string
+             * @return std::string_view The copy, valid until the next reset
+             */
+            std::string_view store(std::string_view aText);
+
+            /**
+             * @brief Copy values into the arena
+             *
+             * @tparam Type The type of the values, trivially copyable
+             * @param aValues The values
+             * @return std::span<const Type> The copy, valid until the next reset
+             */
+            template<typename Type>
+            std::span<const Type> store(std::span<const Type> aValues)
+            {
+                static_assert(std::is_trivially_copyable_v<Type>, "The arena only stores trivially copyable values");
+                if (aValues.empty()) {
+                    return {};
+                }
+                auto *data = allocate(aValues.size_bytes(), alignof(Type));
+
+                std::memcpy(data, aValues.data(), aValues.size_bytes());
+                return std::span<const Type>(static_cast<const Type *>(data), aValues.size());
+            }
+
+            /**
+             * @brief Forget all the allocations, keeping the chunks for the next frame
+             * @details Every view given by the arena dangles afterwards
+             */
+            void reset();
+
+            /**
+             * @brief Get the number of bytes allocated since the last reset
+             *
+             * @return std::size_t The number of bytes
+             */
+            [[nodiscard]] std::size_t bytesUsed() const;
+
+            /**
+             * @brief Get the size of all the chunks
+             *
+             * @return std::size_t The number of bytes
+             */
+            [[nodiscard]] std::size_t bytesReserved() const;
+#pragma endregion methods
+    };
+} // namespace Engine::Event
+
+#endif /* !EVENTARENA_HPP_ */
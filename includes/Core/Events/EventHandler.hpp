@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <mutex>
+#include <span>
 #include <vector>
 
 namespace Engine::Event {
@@ -22,7 +23,7 @@ namespace Engine::Event {
 
         private:
             containerT _events;
-            std::mutex _mutex;
+            mutable std::mutex _mutex;
 
         public:
 #pragma region constructors / destructors
@@ -78,6 +79,18 @@ namespace Engine::Event {
                 _events.push_back(aEvent);
             }
 
+            /**
+             * @brief Push several events under a single lock
+             * @details Can wait for the mutex to be unlocked
+             * @param aEvents the new events to add to the list
+             */
+            void pushEvents(std::span<const Event> aEvents)
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                _events.insert(_events.end(), aEvents.begin(), aEvents.end());
+            }
+
             /**
              * @brief Get the Events object
              *
@@ -98,6 +111,18 @@ namespace Engine::Event {
                 return _events;
             }
 
+            /**
+             * @brief Get the number of queued events
+             * @details Can wait for the mutex to be unlocked
+             * @return std::size_t the number of events
+             */
+            std::size_t size() const
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                return _events.size();
+            }
+
             /**
              * @brief Erase all the events
              * @details Can wait for the mutex to be unlocked
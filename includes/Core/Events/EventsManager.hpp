@@ -4,9 +4,15 @@
 #include <any>
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <tuple>
 #include <typeindex>
 #include <utility>
 #include <vector>
+#include "EventArena.hpp"
 #include "EventHandler.hpp"
 #include "Exception.hpp"
 #include <boost/container/flat_map.hpp>
@@ -17,18 +23,23 @@ namespace Engine::Event {
 
     /**
      * @brief EventManager class is a singleton that manage all events
-     *
+     * @details The handlers can be registered while other threads push or read events, e.g. by the scripts of
+     * worlds ticked in parallel: the map is guarded by a shared mutex and each handler has a stable address, so the
+     * handler a thread got stays valid when another type is registered
      */
     class EventManager final
     {
         public:
-            using func = std::function<void(EventManager &)>;
-            using eventHandler = std::pair<std::any, func>;
+            using func = std::function<void(std::any &)>;
+            using countFunc = std::function<std::size_t(std::any &)>;
+            using eventHandler = std::pair<std::any, std::tuple<func, countFunc>>;
 
         private:
             EventManager();
 
-            boost::container::flat_map<std::type_index, eventHandler> _eventsHandler;
+            boost::container::flat_map<std::type_index, std::unique_ptr<eventHandler>> _eventsHandler;
+            mutable std::shared_mutex _handlersMutex;
+            EventArena _arena;
 
         public:
             //------------------- DESTRUCTOR-------------------//
@@ -95,6 +106,24 @@ namespace Engine::Event {
                 }
             }
 
+            /**
+             * @brief Push several events of a type to the queue, locking once
+             * @details Doesn't call the subscribers
+             * @param aEvents The events to push.
+             * @tparam Event The type of the events.
+             */
+            template<typename Event>
+            void pushEvents(std::span<const Event> aEvents)
+            {
+                try {
+                    auto &handler = getHandler<Event>();
+
+                    handler.pushEvents(aEvents);
+                } catch (const std::bad_any_cast &e) {
+                    throw EventManagerExceptionNoHandler("Can't push events");
+                }
+            }
+
             /**
              * @brief Get all the events of a specific type
              * @tparam Event The type of the event.
@@ -120,10 +149,11 @@ namespace Engine::Event {
             void keepEventsAndClear()
             {
                 std::vector<std::type_index> eventIndexList = {std::type_index(typeid(EventList))...};
+                std::shared_lock lock(_handlersMutex);
 
                 for (auto &lbd : _eventsHandler) {
                     if (std::find(eventIndexList.begin(), eventIndexList.end(), lbd.first) == eventIndexList.end()) {
-                        lbd.second.second(*this);
+                        std::get<0>(lbd.second->second)(lbd.second->first);
                     }
                 }
             }
@@ -137,18 +167,12 @@ namespace Engine::Event {
             template<typename Event>
             void removeEvent(const std::size_t aIndex)
             {
-                auto eventIndex = std::type_index(typeid(Event));
+                auto *handler = findHandler<Event>();
 
-                if (_eventsHandler.find(eventIndex) == _eventsHandler.end()) {
+                if (handler == nullptr) {
                     return;
                 }
-                try {
-                    auto &handler = getHandler<Event>();
-
-                    handler.removeEvent(aIndex);
-                } catch (const std::bad_any_cast &e) {
-                    throw EventManagerExceptionNoHandler("Can't remove event");
-                }
+                handler->removeEvent(aIndex);
             }
 
             /**
@@ -160,37 +184,62 @@ namespace Engine::Event {
             template<typename Event>
             void removeEvent(std::vector<size_t> aIndexes)
             {
-                auto eventIndex = std::type_index(typeid(Event));
+                auto *handler = findHandler<Event>();
 
-                if (_eventsHandler.find(eventIndex) == _eventsHandler.end()) {
+                if (handler == nullptr) {
                     return;
                 }
-                try {
-                    auto &handler = getHandler<Event>();
-
-                    for (size_t i = 0; i < aIndexes.size(); i++) {
-                        size_t idx = aIndexes[i] - i;
+                for (size_t i = 0; i < aIndexes.size(); i++) {
+                    size_t idx = aIndexes[i] - i;
 
-                        handler.removeEvent(idx);
-                    }
-                } catch (const std::bad_any_cast &e) {
-                    throw EventManagerExceptionNoHandler("Can't remove event");
+                    handler->removeEvent(idx);
                 }
             }
 
+            /**
+             * @brief Get the number of events queued, all types together
+             * @return std::size_t The number of events
+             */
+            std::size_t getEventCount();
+
+            /**
+             * @brief Get the arena holding the variable-size payloads of the events
+             * @details Store the strings and arrays of an event in it and keep views in the event, then reset it at
+             * the end of the frame, once the events holding views are cleared:
+             * @code
+             * auto &manager = EventManager::getInstance();
+             *
+             * manager.pushEvent(ChatEvent {sender, manager.getArena().store(text)});
+             * ...
+             * manager.keepEventsAndClear<>();
+             * manager.getArena().reset();
+             * @endcode
+             * @return EventArena& The arena
+             */
+            EventArena &getArena();
+
+            /**
+             * @brief Register the handler of an event type, does nothing if it is already registered
+             * @details Thread safe, can be called while other threads push or read events
+             * @tparam Event The type of the event.
+             */
             template<typename Event>
             void initEventHandler()
             {
                 auto eventTypeIndex = std::type_index(typeid(Event));
+                std::unique_lock lock(_handlersMutex);
 
                 if (_eventsHandler.find(eventTypeIndex) != _eventsHandler.end()) {
                     return;
                 }
-                _eventsHandler[eventTypeIndex] = std::make_pair(EventHandler<Event>(), [](EventManager &aEventManager) {
-                    auto &handler = aEventManager.getHandler<Event>();
-
-                    handler.clearEvents();
-                });
+                _eventsHandler[eventTypeIndex] = std::make_unique<eventHandler>(
+                    EventHandler<Event>(), std::make_tuple(
+                                               [](std::any &aHandler) {
+                                                   std::any_cast<EventHandler<Event> &>(aHandler).clearEvents();
+                                               },
+                                               [](std::any &aHandler) {
+                                                   return std::any_cast<EventHandler<Event> &>(aHandler).size();
+                                               }));
             }
 
             template<typename... EventList>
@@ -209,19 +258,30 @@ namespace Engine::Event {
             template<typename Event>
             EventHandler<Event> &getHandler()
             {
-                auto eventTypeIndex = std::type_index(typeid(Event));
-
-                try {
-                    if (_eventsHandler.find(eventTypeIndex) == _eventsHandler.cend()) {
-                        throw EventManagerExceptionNoHandler("There is no handler of this type");
-                    }
-                    auto &handler = _eventsHandler.at(eventTypeIndex);
-                    auto &component = std::any_cast<EventHandler<Event> &>(handler);
+                auto *handler = findHandler<Event>();
 
-                    return component;
-                } catch (const std::bad_any_cast &e) {
+                if (handler == nullptr) {
                     throw EventManagerExceptionNoHandler("There is no handler of this type");
                 }
+                return *handler;
+            }
+
+            /**
+             * @brief Find the Handler linked to an event, under the shared lock of the map
+             *
+             * @tparam Event The type of the event to get the handler
+             * @return EventHandler<Event>* The handler of the event, nullptr if it isn't registered
+             */
+            template<typename Event>
+            EventHandler<Event> *findHandler()
+            {
+                std::shared_lock lock(_handlersMutex);
+                const auto found = _eventsHandler.find(std::type_index(typeid(Event)));
+
+                if (found == _eventsHandler.end()) {
+                    return nullptr;
+                }
+                return std::any_cast<EventHandler<Event>>(&found->second->first);
             }
     };
 } // namespace Engine::Event
@@ -0,0 +1,148 @@
+#ifndef EXPECTED_HPP_
+#define EXPECTED_HPP_
+
+#include <optional>
+#include <utility>
+#include <variant>
+
+namespace Engine::Core {
+
+    /**
+     * @brief The error held by an Expected, like std::unexpected
+     *
+     * @tparam Error The type of the error
+     */
+    template<typename Error>
+    class Unexpected
+    {
+        public:
+            explicit Unexpected(Error aError)
+                : _error(std::move(aError))
+            {}
+
+            [[nodiscard]] const Error &error() const
+            {
+                return _error;
+            }
+
+        private:
+            Error _error;
+    };
+
+    /**
+     * @brief A value or the error that prevented it, a subset of std::expected (C++23) to keep the hot paths free of
+     * exceptions. Same names as std::expected, so it can be swapped for it once the engine moves to C++23
+     *
+     * @tparam Value The type of the value, void for the operations without result
+     * @tparam Error The type of the error
+     */
+    template<typename Value, typename Error>
+    class Expected
+    {
+        public:
+            Expected(Value aValue)
+                : _result(std::in_place_index<0>, std::move(aValue))
+            {}
+
+            Expected(Unexpected<Error> aError)
+                : _result(std::in_place_index<1>, aError.error())
+            {}
+
+            [[nodiscard]] bool has_value() const
+            {
+                return _result.index() == 0;
+            }
+
+            explicit operator bool() const
+            {
+                return has_value();
+            }
+
+            /**
+             * @brief Get the value, it must be there
+             */
+            Value &value()
+            {
+                return std::get<0>(_result);
+            }
+
+            [[nodiscard]] const Value &value() const
+            {
+                return std::get<0>(_result);
+            }
+
+            Value &operator*()
+            {
+                return value();
+            }
+
+            const Value &operator*() const
+            {
+                return value();
+            }
+
+            Value *operator->()
+            {
+                return &value();
+            }
+
+            const Value *operator->() const
+            {
+                return &value();
+            }
+
+            /**
+             * @brief Get the error, there must be no value
+             */
+            [[nodiscard]] const Error &error() const
+            {
+                return std::get<1>(_result);
+            }
+
+            /**
+             * @brief Get the value, or a default one if there is an error
+             */
+            template<typename Default>
+            [[nodiscard]] Value value_or(Default &&aDefault) const
+            {
+                return has_value() ? value() : static_cast<Value>(std::forward<Default>(aDefault));
+            }
+
+        private:
+            std::variant<Value, Error> _result;
+    };
+
+    template<typename Error>
+    class Expected<void, Error>
+    {
+        public:
+            Expected() = default;
+
+            Expected(Unexpected<Error> aError)
+                : _error(aError.error())
+            {}
+
+            [[nodiscard]] bool has_value() const
+            {
+                return !_error.has_value();
+            }
+
+            explicit operator bool() const
+            {
+                return has_value();
+            }
+
+            /**
+             * @brief Get the error, there must be one
+             */
+            [[nodiscard]] const Error &error() const
+            {
+                return *_error;
+            }
+
+        private:
+            std::optional<Error> _error;
+    };
+} // namespace Engine::Core
+
+#endif /* !EXPECTED_HPP_ */
@@ -0,0 +1,197 @@
+#ifndef JOBSYSTEM_HPP_
+#define JOBSYSTEM_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "WorkStealingDeque.hpp"
+
+namespace Engine::Core {
+    class JobSystem;
+
+    /**
+     * @brief Count the jobs submitted with it that are not done yet
+     * @details Jobs submitted with submitAfter start once the counter reaches zero. The first exception thrown by
+     * one of its jobs is rethrown by JobSystem::wait, which must return before the counter is destroyed.
+     */
+    class JobCounter final
+    {
+        private:
+            friend class JobSystem;
+
+            struct Continuation
+            {
+                    std::function<void()> job;
+                    JobCounter *counter;
+            };
+
+            std::atomic<std::size_t> _pending {0};
+            std::mutex _mutex;
+            std::exception_ptr _error;
+            std::vector<Continuation> _continuations;
+
+        public:
+#pragma region constructors / destructors
+            JobCounter() = default;
+            ~JobCounter() = default;
+
+            JobCounter(const JobCounter &other) = delete;
+            JobCounter &operator=(const JobCounter &other) = delete;
+
+            JobCounter(JobCounter &&other) noexcept = delete;
+            JobCounter &operator=(JobCounter &&other) noexcept = delete;
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            /**
+             * @brief Check if every job of the counter is done
+             *
+             * @return true if no job is pending
+             */
+            [[nodiscard]] bool isDone() const
+            {
+                return _pending.load(std::memory_order_acquire) == 0;
+            }
+#pragma endregion methods
+    };
+
+    /**
+     * @brief Run short jobs on a fixed set of workers, each with its own work-stealing deque
+     * @details A job submitted from a worker goes to the bottom of its deque, the others go to a shared queue. Idle
+     * workers steal the oldest jobs of the others. wait runs jobs until the counter is done instead of blocking, so
+     * jobs can wait for other jobs. Long blocking work (file loading...) belongs on its own thread.
+     */
+    class JobSystem final
+    {
+        public:
+            using job = std::function<void()>;
+
+        private:
+            struct Job
+            {
+                    job func;
+                    JobCounter *counter;
+            };
+
+            std::vector<std::unique_ptr<WorkStealingDeque<Job *>>> _deques;
+            std::vector<std::thread> _workers;
+            std::deque<Job *> _injected;
+            std::mutex _injectedMutex;
+            std::mutex _sleepMutex;
+            std::condition_variable _wake;
+            std::atomic<std::size_t> _queued {0};
+            std::atomic<std::size_t> _sleeping {0};
+            std::atomic<bool> _stopping {false};
+
+        public:
+#pragma region constructors / destructors
+            /**
+             * @brief Start the workers
+             *
+             * @param aWorkers The number of workers, at least one is started
+             */
+            explicit JobSystem(std::size_t aWorkers = defaultWorkerCount());
+
+            /**
+             * @brief Join the workers, the jobs not started are dropped
+             */
+            ~JobSystem();
+
+            JobSystem(const JobSystem &other) = delete;
+            JobSystem &operator=(const JobSystem &other) = delete;
+
+            JobSystem(JobSystem &&other) noexcept = delete;
+            JobSystem &operator=(JobSystem &&other) noexcept = delete;
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            /**
+             * @brief Get the job system shared by the engine, started on first use
+             *
+             * @return JobSystem& The job system, with defaultWorkerCount workers
+             */
+            static JobSystem &getInstance();
+
+            /**
+             * @brief Get the number of workers matching the hardware, the thread calling wait being the last one
+             *
+             * @return std::size_t The hardware thread count minus one, at least one
+             */
+            static std::size_t defaultWorkerCount();
+
+            /**
+             * @brief Queue a job
+             *
+             * @param aJob The job
+             * @param aCounter The counter tracking the job
+             */
+            void submit(job &&aJob, JobCounter &aCounter);
+
+            /**
+             * @brief Queue a job once every job of a counter is done
+             *
+             * @param aDependency The counter to wait for
+             * @param aJob The job
+             * @param aCounter The counter tracking the job, it counts it right away
+             */
+            void submitAfter(JobCounter &aDependency, job &&aJob, JobCounter &aCounter);
+
+            /**
+             * @brief Run jobs until every job of the counter is done
+             * @throw The first exception thrown by a job of the counter
+             * @param aCounter The counter
+             */
+            void wait(JobCounter &aCounter);
+
+            /**
+             * @brief Split a range into jobs and wait for them
+             * @throw The first exception thrown by aFunc
+             * @param aCount The size of the range
+             * @param aGrain The size of each job, the last one may be smaller
+             * @param aFunc Called with the begin and end of each part
+             */
+            template<typename Func>
+            void parallelFor(std::size_t aCount, std::size_t aGrain, Func &&aFunc)
+            {
+                JobCounter counter;
+                const auto grain = std::max<std::size_t>(aGrain, 1);
+
+                for (std::size_t begin = 0; begin < aCount; begin += grain) {
+                    const auto end = std::min(aCount, begin + grain);
+
+                    submit(
+                        [&aFunc, begin, end]() {
+                            aFunc(begin, end);
+                        },
+                        counter);
+                }
+                wait(counter);
+            }
+
+            /**
+             * @brief Get the number of workers
+             *
+             * @return std::size_t The number of workers
+             */
+            [[nodiscard]] std::size_t size() const;
+#pragma endregion methods
+
+        private:
+            void push(Job *aJob);
+            Job *take();
+            void execute(Job *aJob);
+            void finish(JobCounter &aCounter);
+            void work(std::size_t aWorker);
+    };
+} // namespace Engine::Core
+
+#endif /* !JOBSYSTEM_HPP_ */
@@ -0,0 +1,40 @@
+#ifndef MEMORYSTATS_HPP_
+#define MEMORYSTATS_HPP_
+
+#include <cstddef>
+
+namespace Engine::Core {
+
+    /**
+     * @brief Memory used by a storage, or a sum of storages
+     * @details Only the memory of the storage itself is counted, not the heap memory owned by the components
+     */
+    struct MemoryStats
+    {
+            std::size_t bytesReserved = 0;
+            std::size_t bytesLive = 0;
+            std::size_t slots = 0;
+            std::size_t liveSlots = 0;
+
+            /**
+             * @brief Get the ratio of slots holding a component
+             *
+             * @return double The ratio, between 0 and 1
+             */
+            [[nodiscard]] double occupancy() const
+            {
+                return slots == 0 ? 0.0 : static_cast<double>(liveSlots) / static_cast<double>(slots);
+            }
+
+            MemoryStats &operator+=(const MemoryStats &aOther)
+            {
+                bytesReserved += aOther.bytesReserved;
+                bytesLive += aOther.bytesLive;
+                slots += aOther.slots;
+                liveSlots += aOther.liveSlots;
+                return *this;
+            }
+    };
+} // namespace Engine::Core
+
+#endif /* !MEMORYSTATS_HPP_ */
@@ -0,0 +1,268 @@
+#ifndef UDPTRANSPORT_HPP_
+#define UDPTRANSPORT_HPP_
+
+#include <any>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+#include <vector>
+#include "Core/Events/EventsManager.hpp"
+#include "Exception.hpp"
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/container/flat_map.hpp>
+
+namespace Engine::Network {
+
+    DEFINE_EXCEPTION(UdpTransportException);
+    DEFINE_EXCEPTION_FROM(UdpTransportExceptionMessageAlreadyRegistered, UdpTransportException);
+    DEFINE_EXCEPTION_FROM(UdpTransportExceptionMessageNotRegistered, UdpTransportException);
+    DEFINE_EXCEPTION_FROM(UdpTransportExceptionMessageTooLarge, UdpTransportException);
+
+    /**
+     * @brief Traffic of a transport during one tick, between two calls to dispatch
+     */
+    struct TransportStats
+    {
+            std::size_t packetsReceived = 0;
+            std::size_t bytesReceived = 0;
+            std::size_t packetsSent = 0;
+            std::size_t bytesSent = 0;
+            std::size_t packetsDropped = 0;
+    };
+
+    /**
+     * @brief UDP socket feeding the event system in bulk
+     * @details A thread receives the datagrams in batches (recvmmsg on Linux) and appends them to a pooled buffer,
+     * locking once per batch. dispatch, called at the frame boundary, decodes them into a pooled vector per message
+     * type and pushes each vector to the EventManager at once. Sent datagrams are queued and written in batches
+     * (sendmmsg on Linux) by flush.
+     * A datagram is a message id (2 bytes, little endian) followed by the payload, the trivially copyable events
+     * are sent as their bytes so the peers must share the same layout.
+     */
+    class UdpTransport
+    {
+        public:
+            using endpoint = boost::asio::ip::udp::endpoint;
+            using messageId = std::uint16_t;
+            using decodeFunc = std::function<bool(std::any &, std::span<const std::byte>, const endpoint &)>;
+            using flushFunc = std::function<std::size_t(std::any &)>;
+            using message = std::pair<std::any, std::tuple<decodeFunc, flushFunc>>;
+
+            template<typename EventType>
+            using decoder = std::function<std::optional<EventType>(std::span<const std::byte>, const endpoint &)>;
+
+            static constexpr std::size_t headerSize = sizeof(messageId);
+            static constexpr std::size_t defaultBatchSize = 64;
+            static constexpr std::size_t defaultMaxDatagramSize = 1472;
+            static constexpr std::size_t defaultMaxPendingPackets = 65536;
+
+        private:
+            /**
+             * @brief A datagram of a batch, the peer is its sender or its receiver
+             */
+            struct Packet
+            {
+                    std::size_t offset;
+                    std::size_t size;
+                    endpoint peer;
+            };
+
+            /**
+             * @brief Datagrams packed in one buffer, its memory is kept between ticks
+             */
+            struct Batch
+            {
+                    std::vector<std::byte> bytes;
+                    std::vector<Packet> packets;
+
+                    void clear()
+                    {
+                        bytes.clear();
+                        packets.clear();
+                    }
+            };
+
+            boost::asio::io_context _context;
+            boost::asio::ip::udp::socket _socket;
+            std::size_t _batchSize;
+            std::size_t _maxDatagramSize;
+            std::size_t _maxPendingPackets;
+            std::mutex _mutex;
+            Batch _received;
+            Batch _dispatched;
+            Batch _outgoing;
+            boost::container::flat_map<messageId, message> _messages;
+            boost::container::flat_map<std::type_index, messageId> _ids;
+            std::atomic<std::size_t> _dropped {0};
+            TransportStats _current;
+            TransportStats _tickStats;
+            std::atomic<bool> _running {true};
+            std::thread _receiver;
+
+        public:
+#pragma region constructors / destructors
+            /**
+             * @brief Open the socket and start the receiving thread
+             *
+             * @param aLocal The address and port to bind, port 0 picks a free one
+             * @param aBatchSize The maximum number of datagrams per system call
+             * @param aMaxDatagramSize The maximum size of a datagram, the longer ones are dropped
+             * @param aMaxPendingPackets The maximum number of datagrams waiting for dispatch, the next ones are dropped
+             */
+            explicit UdpTransport(const endpoint &aLocal, std::size_t aBatchSize = defaultBatchSize,
+                                  std::size_t aMaxDatagramSize = defaultMaxDatagramSize,
+                                  std::size_t aMaxPendingPackets = defaultMaxPendingPackets);
+            ~UdpTransport();
+
+            UdpTransport(const UdpTransport &other) = delete;
+            UdpTransport &operator=(const UdpTransport &other) = delete;
+
+            UdpTransport(UdpTransport &&other) noexcept = delete;
+            UdpTransport &operator=(UdpTransport &&other) noexcept = delete;
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            /**
+             * @brief Get the address and port the socket is bound to
+             *
+             * @return endpoint The local endpoint
+             */
+            [[nodiscard]] endpoint localEndpoint() const;
+
+            /**
+             * @brief Register a message decoded from its bytes into an event of the EventManager
+             *
+             * @tparam EventType The event, trivially copyable
+             * @param aId The id of the message
+             * @throw UdpTransportExceptionMessageAlreadyRegistered If the id or the event is already registered
+             */
+            template<typename EventType>
+            void registerMessage(messageId aId)
+            {
+                static_assert(std::is_trivially_copyable_v<EventType>,
+                              "Give a decoder for the events that aren't trivially copyable");
+                registerMessage<EventType>(aId, [](std::span<const std::byte> aPayload,
+                                                   const endpoint & /*aFrom*/) -> std::optional<EventType> {
+                    if (aPayload.size() != sizeof(EventType)) {
+                        return std::nullopt;
+                    }
+                    EventType event;
+
+                    std::memcpy(&event, aPayload.data(), sizeof(EventType));
+                    return event;
+                });
+            }
+
+            /**
+             * @brief Register a message decoded by a function into an event of the EventManager
+             *
+             * @tparam EventType The event
+             * @param aId The id of the message
+             * @param aDecoder Build the event from the payload and the sender, nullopt drops the datagram
+             * @throw UdpTransportExceptionMessageAlreadyRegistered If the id or the event is already registered
+             */
+            template<typename EventType>
+            void registerMessage(messageId aId, decoder<EventType> aDecoder)
+            {
+                const auto typeIndex = std::type_index(typeid(EventType));
+
+                if (_messages.contains(aId) || _ids.contains(typeIndex)) {
+                    throw UdpTransportExceptionMessageAlreadyRegistered("Message already registered");
+                }
+                Event::EventManager::getInstance().initEventHandler<EventType>();
+                _ids[typeIndex] = aId;
+                _messages[aId] = std::make_pair(
+                    std::vector<EventType>(),
+                    std::make_tuple(
+                        [aDecoder = std::move(aDecoder)](std::any &aPool, std::span<const std::byte> aPayload,
+                                                         const endpoint &aFrom) {
+                            auto event = aDecoder(aPayload, aFrom);
+
+                            if (!event.has_value()) {
+                                return false;
+                            }
+                            std::any_cast<std::vector<EventType> &>(aPool).push_back(std::move(*event));
+                            return true;
+                        },
+                        [](std::any &aPool) {
+                            auto &events = std::any_cast<std::vector<EventType> &>(aPool);
+                            const auto count = events.size();
+
+                            if (count > 0) {
+                                Event::EventManager::getInstance().pushEvents(std::span<const EventType>(events));
+                                events.clear();
+                            }
+                            return count;
+                        }));
+            }
+
+            /**
+             * @brief Queue an event to send as its bytes, written by the next flush
+             *
+             * @tparam EventType The event, trivially copyable and registered
+             * @param aTo The receiver
+             * @param aEvent The event
+             * @throw UdpTransportExceptionMessageNotRegistered If the event isn't registered
+             */
+            template<typename EventType>
+            void send(const endpoint &aTo, const EventType &aEvent)
+            {
+                static_assert(std::is_trivially_copyable_v<EventType>,
+                              "Use sendRaw for the events that aren't trivially copyable");
+                const auto found = _ids.find(std::type_index(typeid(EventType)));
+
+                if (found == _ids.end()) {
+                    throw UdpTransportExceptionMessageNotRegistered("Message not registered");
+                }
+                sendRaw(aTo, found->second,
+                        std::span<const std::byte>(reinterpret_cast<const std::byte *>(&aEvent), sizeof(EventType)));
+            }
+
+            /**
+             * @brief Queue a datagram, written by the next flush
+             *
+             * @param aTo The receiver
+             * @param aId The id of the message
+             * @param aPayload The bytes following the id
+             * @throw UdpTransportExceptionMessageTooLarge If the datagram is larger than the maximum datagram size
+             */
+            void sendRaw(const endpoint &aTo, messageId aId, std::span<const std::byte> aPayload);
+
+            /**
+             * @brief Write the queued datagrams, a batch per system call
+             */
+            void flush();
+
+            /**
+             * @brief Decode the datagrams received since the last call and push them to the EventManager, one push
+             * per message type, then start a new tick for the stats
+             *
+             * @return std::size_t The number of events pushed
+             */
+            std::size_t dispatch();
+
+            /**
+             * @brief Get the traffic of the last tick, closed by dispatch
+             *
+             * @return const TransportStats& The stats
+             */
+            [[nodiscard]] const TransportStats &getTickStats() const;
+#pragma endregion methods
+
+        private:
+            void receiveLoop();
+    };
+} // namespace Engine::Network
+
+#endif /* !UDPTRANSPORT_HPP_ */
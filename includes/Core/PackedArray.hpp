@@ -0,0 +1,439 @@
+#ifndef PACKEDARRAY_HPP_
+#define PACKEDARRAY_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Exception.hpp"
+#include "MemoryStats.hpp"
+
+namespace Engine::Core {
+
+    DEFINE_EXCEPTION(PackedArrayException);
+    DEFINE_EXCEPTION_FROM(PackedArrayExceptionOutOfRange, PackedArrayException);
+    DEFINE_EXCEPTION_FROM(PackedArrayExceptionEmpty, PackedArrayException);
+
+    /**
+     * @brief PackedArray stores ONE component type in a dense array, without holes
+     * @details A sparse array maps each entity to its position in the dense array, and the dense array keeps the
+     * entity of each component. Erasing swaps the last component into the hole. Select it for a component by
+     * specializing ComponentStorage, it is required for the components owned by a group.
+     *
+     * @tparam Component The type of the components to store
+     */
+    template<typename Component>
+    class PackedArray final
+    {
+        public:
+            static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+            using compRef = Component &;
+            using constCompRef = const Component &;
+            using vectArray = std::vector<Component>;
+            using vectIndex = std::size_t;
+            using iterator = typename vectArray::iterator;
+            using constIterator = typename vectArray::const_iterator;
+
+        private:
+            std::vector<vectIndex> _sparse;
+            std::vector<vectIndex> _entities;
+            vectArray _dense;
+            std::uint64_t _presenceVersion = 0;
+
+        public:
+#pragma region constructors / destructors
+            PackedArray() = default;
+            ~PackedArray() = default;
+
+            PackedArray(const PackedArray &other) = default;
+            PackedArray &operator=(const PackedArray &other) = default;
+
+            PackedArray(PackedArray &&other) noexcept = default;
+            PackedArray &operator=(PackedArray &&other) noexcept = default;
+#pragma endregion constructors / destructors
+
+#pragma region operators
+            /**
+             * @brief Get the component of the given entity
+             * @throw PackedArrayExceptionOutOfRange if the index is out of range
+             * @throw PackedArrayExceptionEmpty if the component is empty
+             * @param aIndex The entity
+             * @return compRef The component of the entity
+             */
+            compRef operator[](vectIndex aIndex)
+            {
+                return get(aIndex);
+            }
+
+            constCompRef operator[](vectIndex aIndex) const
+            {
+                return get(aIndex);
+            }
+#pragma endregion operators
+
+#pragma region methods
+            /**
+             * @brief Get the component of the given entity
+             * @throw PackedArrayExceptionOutOfRange if the index is out of range
+             * @throw PackedArrayExceptionEmpty if the component is empty
+             * @param aIndex The entity
+             * @return compRef The component of the entity
+             */
+            compRef get(vectIndex aIndex)
+            {
+                return _dense[checkedIndexOf(aIndex)];
+            }
+
+            constCompRef get(vectIndex aIndex) const
+            {
+                return _dense[checkedIndexOf(aIndex)];
+            }
+
+            /**
+             * @brief Get the component of the given entity without throwing
+             * @param aIndex The entity
+             * @return Component * The component, nullptr if the index is out of range or empty
+             */
+            Component *tryGet(vectIndex aIndex)
+            {
+                return indexOf(aIndex) != npos ? &_dense[_sparse[aIndex]] : nullptr;
+            }
+
+            [[nodiscard]] const Component *tryGet(vectIndex aIndex) const
+            {
+                return indexOf(aIndex) != npos ? &_dense[_sparse[aIndex]] : nullptr;
+            }
+
+            /**
+             * @brief Get the component of the given entity, only checked by an assertion in debug builds
+             * @details For the callers that already know the entity has it, e.g. from its signature
+             * @param aIndex The entity
+             * @return compRef The component of the entity
+             */
+            compRef getUnchecked(vectIndex aIndex)
+            {
+                assert(indexOf(aIndex) != npos);
+                return _dense[_sparse[aIndex]];
+            }
+
+            constCompRef getUnchecked(vectIndex aIndex) const
+            {
+                assert(indexOf(aIndex) != npos);
+                return _dense[_sparse[aIndex]];
+            }
+
+            /**
+             * @brief Set the component of the given entity
+             * @throw PackedArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The entity
+             * @param aValue The value to set
+             */
+            void set(vectIndex aIndex, Component &&aValue)
+            {
+                checkIndex(aIndex);
+                if (_sparse[aIndex] != npos) {
+                    _dense[_sparse[aIndex]] = std::move(aValue);
+                    return;
+                }
+                _sparse[aIndex] = _dense.size();
+                _entities.push_back(aIndex);
+                _dense.push_back(std::move(aValue));
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Check if the entity has the component
+             * @throw PackedArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The entity
+             * @return true if the component is set
+             * @return false if the component is not set
+             */
+            [[nodiscard]] bool has(vectIndex aIndex) const
+            {
+                checkIndex(aIndex);
+                return _sparse[aIndex] != npos;
+            }
+
+            /**
+             * @brief Check if the component at the given index is set, without throwing
+             * @param aIndex The index to check
+             * @return true if the component is set
+             * @return false if the component is not set or the index is out of range
+             */
+            [[nodiscard]] bool contains(vectIndex aIndex) const
+            {
+                return indexOf(aIndex) != npos;
+            }
+
+            /**
+             * @brief Init the entity, will resize the sparse array if needed and erase its component
+             * @param aIndex The entity
+             */
+            void init(vectIndex aIndex)
+            {
+                if (aIndex >= _sparse.size()) {
+                    _sparse.resize(aIndex + 1, npos);
+                }
+                if (_sparse[aIndex] != npos) {
+                    erase(aIndex);
+                }
+            }
+
+            /**
+             * @brief Build the component of the given entity, will resize the sparse array if needed
+             * @param aIndex The entity
+             * @param aArgs The arguments used to build the component
+             * @return compRef The component inserted
+             */
+            template<typename... Args>
+            compRef emplace(vectIndex aIndex, Args &&...aArgs)
+            {
+                if (aIndex >= _sparse.size()) {
+                    _sparse.resize(aIndex + 1, npos);
+                }
+                if (_sparse[aIndex] != npos) {
+                    _dense[_sparse[aIndex]] = Component(std::forward<Args>(aArgs)...);
+                    return _dense[_sparse[aIndex]];
+                }
+                _sparse[aIndex] = _dense.size();
+                _entities.push_back(aIndex);
+                _presenceVersion++;
+                return _dense.emplace_back(std::forward<Args>(aArgs)...);
+            }
+
+            /**
+             * @brief Erase the component of the given entity, the last component takes its place
+             * @throw PackedArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The entity
+             */
+            void erase(vectIndex aIndex)
+            {
+                checkIndex(aIndex);
+                const auto position = _sparse[aIndex];
+
+                if (position == npos) {
+                    return;
+                }
+                swapEntries(position, _dense.size() - 1);
+                _dense.pop_back();
+                _entities.pop_back();
+                _sparse[aIndex] = npos;
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Destroy all the components
+             */
+            void clear()
+            {
+                _sparse.clear();
+                _entities.clear();
+                _dense.clear();
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Give the component of an entity to another one, the component isn't moved in the dense array
+             * @details Nothing is moved if the first entity is out of range, the sparse array grows to fit the second
+             * one, whose component is erased
+             * @param aFrom The entity to move from
+             * @param aTo The entity to move to
+             */
+            void relocate(vectIndex aFrom, vectIndex aTo)
+            {
+                if (aFrom >= _sparse.size() || aFrom == aTo) {
+                    return;
+                }
+                init(aTo);
+                const auto position = _sparse[aFrom];
+
+                if (position == npos) {
+                    return;
+                }
+                _entities[position] = aTo;
+                _sparse[aTo] = position;
+                _sparse[aFrom] = npos;
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Remove the trailing entities without component from the sparse array, never below aSize, and
+             * release the unused memory
+             * @param aSize The minimum size to keep
+             */
+            void shrinkToFit(vectIndex aSize)
+            {
+                auto newSize = _sparse.size();
+
+                while (newSize > aSize && _sparse[newSize - 1] == npos) {
+                    newSize--;
+                }
+                _sparse.resize(newSize);
+                _sparse.shrink_to_fit();
+                _entities.shrink_to_fit();
+                _dense.shrink_to_fit();
+            }
+
+            /**
+             * @brief Remove all the trailing entities without component and release the unused memory
+             * @return vectIndex The new size of the sparse array
+             */
+            vectIndex compact()
+            {
+                shrinkToFit(0);
+                return _sparse.size();
+            }
+
+            /**
+             * @brief Get the memory used by the array
+             * @return MemoryStats The memory used, the slots are the entries of the sparse array
+             */
+            [[nodiscard]] MemoryStats memoryStats() const
+            {
+                return MemoryStats {_sparse.capacity() * sizeof(vectIndex) + _entities.capacity() * sizeof(vectIndex)
+                                        + _dense.capacity() * sizeof(Component),
+                                    _dense.size() * (sizeof(Component) + sizeof(vectIndex)), _sparse.size(),
+                                    _dense.size()};
+            }
+
+            /**
+             * @brief Get the version of the set of filled slots, changed by each call adding or removing a component
+             * @details Lets the World notice the components added or removed through the storage instead of its own
+             * API
+             * @return std::uint64_t The version
+             */
+            [[nodiscard]] std::uint64_t presenceVersion() const
+            {
+                return _presenceVersion;
+            }
+
+            /**
+             * @brief Get the position of the component of an entity in the dense array
+             *
+             * @param aIndex The entity
+             * @return vectIndex The position, npos if the entity doesn't have the component
+             */
+            [[nodiscard]] vectIndex indexOf(vectIndex aIndex) const
+            {
+                return aIndex < _sparse.size() ? _sparse[aIndex] : npos;
+            }
+
+            /**
+             * @brief Swap two components of the dense array, keeping the sparse array in sync
+             *
+             * @param aFirst The position of the first component
+             * @param aSecond The position of the second component
+             */
+            void swapEntries(vectIndex aFirst, vectIndex aSecond)
+            {
+                if (aFirst == aSecond) {
+                    return;
+                }
+                std::swap(_dense[aFirst], _dense[aSecond]);
+                std::swap(_entities[aFirst], _entities[aSecond]);
+                _sparse[_entities[aFirst]] = aFirst;
+                _sparse[_entities[aSecond]] = aSecond;
+            }
+
+            /**
+             * @brief Get the dense array of components
+             *
+             * @return std::span<Component> The components, without holes
+             */
+            std::span<Component> data()
+            {
+                return std::span<Component>(_dense);
+            }
+
+            [[nodiscard]] std::span<const Component> data() const
+            {
+                return std::span<const Component>(_dense);
+            }
+
+            /**
+             * @brief Get the entity of each component of the dense array
+             *
+             * @return std::span<const vectIndex> The entities
+             */
+            [[nodiscard]] std::span<const vectIndex> entities() const
+            {
+                return std::span<const vectIndex>(_entities);
+            }
+
+            /**
+             * @brief Get the number of components stored
+             *
+             * @return vectIndex The number of components
+             */
+            [[nodiscard]] vectIndex size() const
+            {
+                return _dense.size();
+            }
+#pragma endregion methods
+
+#pragma region iterator
+            iterator begin()
+            {
+                return _dense.begin();
+            }
+
+            iterator end()
+            {
+                return _dense.end();
+            }
+
+            constIterator begin() const
+            {
+                return _dense.begin();
+            }
+
+            constIterator end() const
+            {
+                return _dense.end();
+            }
+
+            constIterator cbegin() const
+            {
+                return _dense.cbegin();
+            }
+
+            constIterator cend() const
+            {
+                return _dense.cend();
+            }
+#pragma endregion iterator
+
+        private:
+            void checkIndex(vectIndex aIndex) const
+            {
+                if (aIndex >= _sparse.size()) {
+                    throw PackedArrayExceptionOutOfRange("index out of range: " + std::to_string(aIndex));
+                }
+            }
+
+            [[nodiscard]] vectIndex checkedIndexOf(vectIndex aIndex) const
+            {
+                checkIndex(aIndex);
+                if (_sparse[aIndex] == npos) {
+                    throw PackedArrayExceptionEmpty("index is empty: " + std::to_string(aIndex));
+                }
+                return _sparse[aIndex];
+            }
+    };
+
+    template<typename Storage>
+    struct IsPackedArray : std::false_type
+    {};
+
+    template<typename Component>
+    struct IsPackedArray<PackedArray<Component>> : std::true_type
+    {};
+} // namespace Engine::Core
+
+#endif /* !PACKEDARRAY_HPP_ */
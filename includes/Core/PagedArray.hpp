@@ -0,0 +1,420 @@
+#ifndef PAGEDARRAY_HPP_
+#define PAGEDARRAY_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Exception.hpp"
+#include "MemoryStats.hpp"
+
+namespace Engine::Core {
+
+    DEFINE_EXCEPTION(PagedArrayException);
+    DEFINE_EXCEPTION_FROM(PagedArrayExceptionOutOfRange, PagedArrayException);
+    DEFINE_EXCEPTION_FROM(PagedArrayExceptionEmpty, PagedArrayException);
+
+    /**
+     * @brief Number of slots of a page of PagedArray, a power of two filling about 16 KiB
+     *
+     * @tparam Component The type of the components to store
+     */
+    template<typename Component>
+    inline constexpr std::size_t defaultPageSize =
+        std::bit_floor(std::max<std::size_t>(16384 / sizeof(std::optional<Component>), 1));
+
+    /**
+     * @brief PagedArray stores ONE component type in fixed-size pages, allocated when a slot of theirs is first used
+     * @details Each index represents the entity at the same index, like SparseArray, but growing only allocates a new
+     * page: the components are never moved, so a reference to a component stays valid until the component is erased
+     * (or the entity relocated), or the storage copied because it was shared with a World::fork. Select it by
+     * specializing ComponentStorage, for the large components or the ones referenced across spawns.
+     *
+     * @tparam Component The type of the components to store
+     * @tparam PageSize The number of slots per page, a power of two
+     */
+    template<typename Component, std::size_t PageSize = defaultPageSize<Component>>
+    class PagedArray final
+    {
+            static_assert(std::has_single_bit(PageSize), "The page size must be a power of two");
+
+        public:
+            using compRef = Component &;
+            using constCompRef = const Component &;
+            using optComponent = std::optional<Component>;
+            using vectIndex = std::size_t;
+
+            static constexpr std::size_t pageSize = PageSize;
+
+        private:
+            static constexpr std::size_t pageShift = std::countr_zero(PageSize);
+            static constexpr std::size_t pageMask = PageSize - 1;
+
+            struct Page
+            {
+                    std::array<optComponent, PageSize> slots;
+                    std::size_t live = 0;
+            };
+
+            std::vector<std::unique_ptr<Page>> _pages;
+            vectIndex _size = 0;
+            std::uint64_t _presenceVersion = 0;
+
+        public:
+#pragma region constructors / destructors
+            PagedArray() = default;
+            ~PagedArray() = default;
+
+            PagedArray(const PagedArray &other)
+                : _size(other._size),
+                  _presenceVersion(other._presenceVersion)
+            {
+                _pages.reserve(other._pages.size());
+                for (const auto &page : other._pages) {
+                    _pages.push_back(page ? std::make_unique<Page>(*page) : nullptr);
+                }
+            }
+
+            PagedArray &operator=(const PagedArray &other)
+            {
+                if (this != &other) {
+                    PagedArray copy(other);
+
+                    *this = std::move(copy);
+                }
+                return *this;
+            }
+
+            PagedArray(PagedArray &&other) noexcept = default;
+            PagedArray &operator=(PagedArray &&other) noexcept = default;
+#pragma endregion constructors / destructors
+
+#pragma region operators
+            /**
+             * @brief Get the component at the given index
+             * @throw PagedArrayExceptionOutOfRange if the index is out of range
+             * @throw PagedArrayExceptionEmpty if the component is empty
+             * @param aIndex The index to get
+             * @return compRef The component at the given index
+             */
+            compRef operator[](vectIndex aIndex)
+            {
+                return get(aIndex);
+            }
+
+            constCompRef operator[](vectIndex aIndex) const
+            {
+                return get(aIndex);
+            }
+#pragma endregion operators
+
+#pragma region methods
+            /**
+             * @brief Get the component at the given index
+             * @throw PagedArrayExceptionOutOfRange if the index is out of range
+             * @throw PagedArrayExceptionEmpty if the component is empty
+             * @param aIndex The index to get
+             * @return compRef The component at the given index
+             */
+            compRef get(vectIndex aIndex)
+            {
+                return **checkedSlot(aIndex);
+            }
+
+            constCompRef get(vectIndex aIndex) const
+            {
+                return **checkedSlot(aIndex);
+            }
+
+            /**
+             * @brief Get the component of the given entity without throwing
+             * @param aIndex The entity
+             * @return Component * The component, nullptr if the index is out of range or empty
+             */
+            Component *tryGet(vectIndex aIndex)
+            {
+                auto *slot = findSlot(aIndex);
+
+                return slot != nullptr && slot->has_value() ? &**slot : nullptr;
+            }
+
+            [[nodiscard]] const Component *tryGet(vectIndex aIndex) const
+            {
+                const auto *slot = findSlot(aIndex);
+
+                return slot != nullptr && slot->has_value() ? &**slot : nullptr;
+            }
+
+            /**
+             * @brief Get the component of the given entity, only checked by an assertion in debug builds
+             * @details For the callers that already know the entity has it, e.g. from its signature
+             * @param aIndex The entity
+             * @return compRef The component of the entity
+             */
+            compRef getUnchecked(vectIndex aIndex)
+            {
+                assert(findSlot(aIndex) != nullptr && findSlot(aIndex)->has_value());
+                return *_pages[aIndex >> pageShift]->slots[aIndex & pageMask];
+            }
+
+            constCompRef getUnchecked(vectIndex aIndex) const
+            {
+                assert(findSlot(aIndex) != nullptr && findSlot(aIndex)->has_value());
+                return *_pages[aIndex >> pageShift]->slots[aIndex & pageMask];
+            }
+
+            /**
+             * @brief Set the component at the given index
+             * @throw PagedArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The index to set
+             * @param aValue The value to set
+             */
+            void set(vectIndex aIndex, Component &&aValue)
+            {
+                checkIndex(aIndex);
+                emplace(aIndex, std::move(aValue));
+            }
+
+            /**
+             * @brief Check if the component at the given index is set
+             * @throw PagedArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The index to check
+             * @return true if the component is set
+             * @return false if the component is not set
+             */
+            [[nodiscard]] bool has(vectIndex aIndex) const
+            {
+                checkIndex(aIndex);
+                const auto *slot = findSlot(aIndex);
+
+                return slot != nullptr && slot->has_value();
+            }
+
+            /**
+             * @brief Check if the component at the given index is set, without throwing
+             * @param aIndex The index to check
+             * @return true if the component is set
+             * @return false if the component is not set or the index is out of range
+             */
+            [[nodiscard]] bool contains(vectIndex aIndex) const
+            {
+                const auto *slot = findSlot(aIndex);
+
+                return slot != nullptr && slot->has_value();
+            }
+
+            /**
+             * @brief Init the component at the given index, will grow the array if needed and erase the component
+             * @details No page is allocated, the pages are allocated by emplace
+             * @param aIndex The index to init
+             */
+            void init(vectIndex aIndex)
+            {
+                _size = std::max(_size, aIndex + 1);
+                if (findSlot(aIndex) != nullptr) {
+                    erase(aIndex);
+                }
+            }
+
+            /**
+             * @brief Build the component at the given index, allocating its page if needed
+             * @details The other components are never moved
+             * @param aIndex The index to set
+             * @param aArgs The arguments used to build the component
+             * @return compRef The component inserted
+             */
+            template<typename... Args>
+            compRef emplace(vectIndex aIndex, Args &&...aArgs)
+            {
+                const auto pageIdx = aIndex >> pageShift;
+
+                if (pageIdx >= _pages.size()) {
+                    _pages.resize(pageIdx + 1);
+                }
+                if (!_pages[pageIdx]) {
+                    _pages[pageIdx] = std::make_unique<Page>();
+                }
+                auto &page = *_pages[pageIdx];
+                auto &slot = page.slots[aIndex & pageMask];
+
+                _size = std::max(_size, aIndex + 1);
+                if (!slot.has_value()) {
+                    page.live++;
+                    _presenceVersion++;
+                }
+                return slot.emplace(std::forward<Args>(aArgs)...);
+            }
+
+            /**
+             * @brief Erase the component at the given index, its page is kept
+             * @throw PagedArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The index to erase
+             */
+            void erase(vectIndex aIndex)
+            {
+                checkIndex(aIndex);
+                auto *slot = findSlot(aIndex);
+
+                if (slot != nullptr && slot->has_value()) {
+                    slot->reset();
+                    _pages[aIndex >> pageShift]->live--;
+                    _presenceVersion++;
+                }
+            }
+
+            /**
+             * @brief Destroy all the components and release the pages
+             */
+            void clear()
+            {
+                _pages.clear();
+                _size = 0;
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Move the component of an index to another one, the first index becomes empty
+             * @details Nothing is moved if the first index is out of range, the array grows to fit the second one
+             * @param aFrom The index to move from
+             * @param aTo The index to move to
+             */
+            void relocate(vectIndex aFrom, vectIndex aTo)
+            {
+                if (aFrom >= _size || aFrom == aTo) {
+                    return;
+                }
+                init(aTo);
+                auto *from = findSlot(aFrom);
+
+                if (from == nullptr || !from->has_value()) {
+                    return;
+                }
+                emplace(aTo, std::move(**from));
+                erase(aFrom);
+            }
+
+            /**
+             * @brief Remove the trailing empty slots, never below aSize, and release the empty pages
+             * @param aSize The minimum size to keep
+             */
+            void shrinkToFit(vectIndex aSize)
+            {
+                while (_size > aSize) {
+                    const auto *slot = findSlot(_size - 1);
+
+                    if (slot != nullptr && slot->has_value()) {
+                        break;
+                    }
+                    _size--;
+                }
+                _pages.resize(std::min(_pages.size(), (_size + pageMask) >> pageShift));
+                for (auto &page : _pages) {
+                    if (page && page->live == 0) {
+                        page.reset();
+                    }
+                }
+                _pages.shrink_to_fit();
+            }
+
+            /**
+             * @brief Remove all the trailing empty slots and release the empty pages
+             * @return vectIndex The new size
+             */
+            vectIndex compact()
+            {
+                shrinkToFit(0);
+                return _size;
+            }
+
+            /**
+             * @brief Get the memory used by the array
+             * @return MemoryStats The memory used, the reserved bytes count the allocated pages
+             */
+            [[nodiscard]] MemoryStats memoryStats() const
+            {
+                std::size_t pages = 0;
+                std::size_t live = 0;
+
+                for (const auto &page : _pages) {
+                    if (page) {
+                        pages++;
+                        live += page->live;
+                    }
+                }
+                return MemoryStats {_pages.capacity() * sizeof(std::unique_ptr<Page>) + pages * sizeof(Page),
+                                    live * sizeof(Component), _size, live};
+            }
+
+            /**
+             * @brief Get the version of the set of filled slots, changed by each call adding or removing a component
+             * @details Lets the World notice the components added or removed through the storage instead of its own
+             * API
+             * @return std::uint64_t The version
+             */
+            [[nodiscard]] std::uint64_t presenceVersion() const
+            {
+                return _presenceVersion;
+            }
+
+            /**
+             * @brief Get the number of slots, the last entity initialized + 1
+             *
+             * @return vectIndex The number of slots
+             */
+            [[nodiscard]] vectIndex size() const
+            {
+                return _size;
+            }
+#pragma endregion methods
+
+        private:
+            [[nodiscard]] optComponent *findSlot(vectIndex aIndex)
+            {
+                const auto pageIdx = aIndex >> pageShift;
+
+                return pageIdx < _pages.size() && _pages[pageIdx] ? &_pages[pageIdx]->slots[aIndex & pageMask]
+                                                                  : nullptr;
+            }
+
+            [[nodiscard]] const optComponent *findSlot(vectIndex aIndex) const
+            {
+                const auto pageIdx = aIndex >> pageShift;
+
+                return pageIdx < _pages.size() && _pages[pageIdx] ? &_pages[pageIdx]->slots[aIndex & pageMask]
+                                                                  : nullptr;
+            }
+
+            void checkIndex(vectIndex aIndex) const
+            {
+                if (aIndex >= _size) {
+                    throw PagedArrayExceptionOutOfRange("index out of range: " + std::to_string(aIndex));
+                }
+            }
+
+            [[nodiscard]] optComponent *checkedSlot(vectIndex aIndex)
+            {
+                return const_cast<optComponent *>(std::as_const(*this).checkedSlot(aIndex));
+            }
+
+            [[nodiscard]] const optComponent *checkedSlot(vectIndex aIndex) const
+            {
+                checkIndex(aIndex);
+                const auto *slot = findSlot(aIndex);
+
+                if (slot == nullptr || !slot->has_value()) {
+                    throw PagedArrayExceptionEmpty("index is empty: " + std::to_string(aIndex));
+                }
+                return slot;
+            }
+    };
+} // namespace Engine::Core
+
+#endif /* !PAGEDARRAY_HPP_ */
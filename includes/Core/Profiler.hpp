@@ -0,0 +1,200 @@
+#ifndef PROFILER_HPP_
+#define PROFILER_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <boost/container/flat_map.hpp>
+
+namespace Engine {
+
+    /**
+     * @brief Record the duration of the frames and of each system, export them as a Chrome trace
+     * @details Filled by World::runSystems when the engine is built with ENGINE_PROFILING (the
+     * patatocs_ENABLE_PROFILING CMake option), otherwise nothing is recorded. The trace can be opened in
+     * chrome://tracing or https://ui.perfetto.dev
+     * The names are interned: recording with a nameId neither looks the name up nor copies it.
+     */
+    class Profiler
+    {
+        public:
+            using clock = std::chrono::steady_clock;
+            using timePoint = clock::time_point;
+            using nameId = std::size_t;
+
+            static constexpr std::size_t defaultWindowSize = 240;
+            static constexpr std::size_t defaultMaxTraceEvents = 100000;
+            static constexpr nameId frameName = 0;
+
+            /**
+             * @brief Statistics over the last recorded durations, in milliseconds
+             */
+            struct Stats
+            {
+                    std::size_t count = 0;
+                    double mean = 0;
+                    double p50 = 0;
+                    double p95 = 0;
+                    double p99 = 0;
+                    double max = 0;
+            };
+
+            /**
+             * @brief One event of the trace, a duration ('X') or a counter ('C')
+             */
+            struct TraceEvent
+            {
+                    nameId name;
+                    char phase;
+                    double timestamp;
+                    double duration;
+                    std::size_t value;
+            };
+
+        private:
+            timePoint _epoch {clock::now()};
+            timePoint _frameStart {};
+            std::size_t _windowSize = defaultWindowSize;
+            std::size_t _maxTraceEvents = defaultMaxTraceEvents;
+            std::deque<double> _frames;
+            std::vector<std::string> _names {"frame"};
+            boost::container::flat_map<std::string, nameId> _nameIds {{"frame", frameName}};
+            std::vector<std::deque<double>> _systems = std::vector<std::deque<double>>(1);
+            std::deque<TraceEvent> _trace;
+
+        public:
+#pragma region constructors / destructors
+            Profiler() = default;
+            ~Profiler() = default;
+
+            Profiler(const Profiler &other) = default;
+            Profiler &operator=(const Profiler &other) = default;
+
+            Profiler(Profiler &&other) noexcept = default;
+            Profiler &operator=(Profiler &&other) noexcept = default;
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            /**
+             * @brief Mark the start of a frame
+             */
+            void beginFrame();
+
+            /**
+             * @brief Mark the end of the frame started by beginFrame, records its duration
+             */
+            void endFrame();
+
+            /**
+             * @brief Get the id of a name, stable for the lifetime of the profiler and its copies
+             *
+             * @param aName The name of a system or counter
+             * @return nameId The id, the same one on each call with the same name
+             */
+            nameId internName(const std::string &aName);
+
+            /**
+             * @brief Get the name of an id
+             *
+             * @param aName The id returned by internName
+             * @return const std::string& The name
+             */
+            [[nodiscard]] const std::string &getName(nameId aName) const;
+
+            /**
+             * @brief Record the update of a system
+             *
+             * @param aName The id of the name of the system
+             * @param aStart When the update started
+             * @param aEnd When the update ended
+             * @param aEntities The number of entities the system processed
+             */
+            void recordSystem(nameId aName, timePoint aStart, timePoint aEnd, std::size_t aEntities);
+
+            /**
+             * @brief Record the update of a system, interning its name
+             *
+             * @param aName The name of the system
+             * @param aStart When the update started
+             * @param aEnd When the update ended
+             * @param aEntities The number of entities the system processed
+             */
+            void recordSystem(const std::string &aName, timePoint aStart, timePoint aEnd, std::size_t aEntities);
+
+            /**
+             * @brief Record the value of a counter, e.g. the number of queued events
+             *
+             * @param aName The id of the name of the counter
+             * @param aValue The value
+             */
+            void recordCounter(nameId aName, std::size_t aValue);
+
+            /**
+             * @brief Record the value of a counter, interning its name
+             *
+             * @param aName The name of the counter
+             * @param aValue The value
+             */
+            void recordCounter(const std::string &aName, std::size_t aValue);
+
+            /**
+             * @brief Get the statistics of the last frames
+             *
+             * @return Stats The statistics, in milliseconds
+             */
+            [[nodiscard]] Stats getFrameStats() const;
+
+            /**
+             * @brief Get the statistics of the last updates of a system
+             *
+             * @param aName The name of the system
+             * @return Stats The statistics, in milliseconds, empty if the system was never recorded
+             */
+            [[nodiscard]] Stats getSystemStats(const std::string &aName) const;
+
+            /**
+             * @brief Get the recorded trace events, the oldest are dropped past the max trace size
+             *
+             * @return const std::deque<TraceEvent>& The events
+             */
+            [[nodiscard]] const std::deque<TraceEvent> &getTrace() const;
+
+            /**
+             * @brief Write the trace in the Chrome trace event JSON format
+             *
+             * @param aStream The stream to write to
+             */
+            void exportChromeTrace(std::ostream &aStream) const;
+
+            /**
+             * @brief Set the number of durations the statistics are computed on
+             *
+             * @param aWindowSize The number of frames / updates kept per system
+             */
+            void setWindowSize(std::size_t aWindowSize);
+
+            /**
+             * @brief Set the maximum number of trace events kept
+             *
+             * @param aMaxTraceEvents The number of events
+             */
+            void setMaxTraceEvents(std::size_t aMaxTraceEvents);
+
+            /**
+             * @brief Forget everything recorded, the interned names and their ids are kept
+             */
+            void clear();
+#pragma endregion methods
+
+        private:
+            [[nodiscard]] double toMicroseconds(timePoint aTime) const;
+            void pushSample(std::deque<double> &aWindow, double aMilliseconds) const;
+            void pushTrace(TraceEvent &&aEvent);
+            [[nodiscard]] static Stats computeStats(const std::deque<double> &aWindow);
+    };
+} // namespace Engine
+
+#endif /* !PROFILER_HPP_ */
@@ -0,0 +1,175 @@
+#ifndef QUERYFILTERS_HPP_
+#define QUERYFILTERS_HPP_
+
+#include <cstddef>
+#include <functional>
+
+namespace Engine::Core {
+    class World;
+
+    /**
+     * @brief Query term: the entity must have the components, they are not passed to the callback
+     */
+    template<typename... Components>
+    struct With
+    {};
+
+    /**
+     * @brief Query term: the entity must not have any of the components
+     */
+    template<typename... Components>
+    struct Without
+    {};
+
+    /**
+     * @brief Query term: the components are passed as pointers to the callback, nullptr when missing
+     */
+    template<typename... Components>
+    struct Optional
+    {};
+
+    /**
+     * @brief Query term: the components are passed by const reference as they were at the last tick boundary, they
+     * must be stored in a DoubleBufferedArray
+     */
+    template<typename... Components>
+    struct Previous
+    {};
+
+    /**
+     * @brief Query term: the resource of the World is passed by const reference, declared as read by the system
+     */
+    template<typename Resource>
+    struct Read
+    {};
+
+    /**
+     * @brief Query term: the resource of the World is passed by reference, declared as written by the system
+     */
+    template<typename Resource>
+    struct Write
+    {};
+
+    template<typename... Types>
+    struct TypeList
+    {};
+
+    template<typename... Lists>
+    struct TypeListConcat;
+
+    template<>
+    struct TypeListConcat<>
+    {
+            using type = TypeList<>;
+    };
+
+    template<typename... Types>
+    struct TypeListConcat<TypeList<Types...>>
+    {
+            using type = TypeList<Types...>;
+    };
+
+    template<typename... First, typename... Second, typename... Rest>
+    struct TypeListConcat<TypeList<First...>, TypeList<Second...>, Rest...>
+    {
+            using type = typename TypeListConcat<TypeList<First..., Second...>, Rest...>::type;
+    };
+
+    /**
+     * @brief Describe how a query term is matched and what it gives to the callback
+     * @details A plain component is required and passed by reference
+     *
+     * @tparam Term The component or filter
+     */
+    template<typename Term>
+    struct QueryTerm
+    {
+            using args = TypeList<Term &>;
+            using required = TypeList<Term>;
+            using excluded = TypeList<>;
+    };
+
+    /**
+     * @brief A const component is required and passed by const reference: it isn't flagged as written for the state
+     * hashes, and a storage shared with a fork isn't copied to read it
+     */
+    template<typename Term>
+    struct QueryTerm<const Term>
+    {
+            using args = TypeList<const Term &>;
+            using required = TypeList<Term>;
+            using excluded = TypeList<>;
+    };
+
+    template<typename... Components>
+    struct QueryTerm<With<Components...>>
+    {
+            using args = TypeList<>;
+            using required = TypeList<Components...>;
+            using excluded = TypeList<>;
+    };
+
+    template<typename... Components>
+    struct QueryTerm<Without<Components...>>
+    {
+            using args = TypeList<>;
+            using required = TypeList<>;
+            using excluded = TypeList<Components...>;
+    };
+
+    template<typename... Components>
+    struct QueryTerm<Optional<Components...>>
+    {
+            using args = TypeList<Components *...>;
+            using required = TypeList<>;
+            using excluded = TypeList<>;
+    };
+
+    template<typename... Components>
+    struct QueryTerm<Previous<Components...>>
+    {
+            using args = TypeList<const Components &...>;
+            using required = TypeList<Components...>;
+            using excluded = TypeList<>;
+    };
+
+    template<typename Resource>
+    struct QueryTerm<Read<Resource>>
+    {
+            using args = TypeList<const Resource &>;
+            using required = TypeList<>;
+            using excluded = TypeList<>;
+    };
+
+    template<typename Resource>
+    struct QueryTerm<Write<Resource>>
+    {
+            using args = TypeList<Resource &>;
+            using required = TypeList<>;
+            using excluded = TypeList<>;
+    };
+
+    template<typename List>
+    struct QueryFunction;
+
+    template<typename... Args>
+    struct QueryFunction<TypeList<Args...>>
+    {
+            using type = std::function<void(World &world, double deltaTime, std::size_t idx, Args...)>;
+    };
+
+    /**
+     * @brief The callback type of a query made of the given terms
+     */
+    template<typename... Terms>
+    using QueryFunc =
+        typename QueryFunction<typename TypeListConcat<typename QueryTerm<Terms>::args...>::type>::type;
+
+    template<typename... Terms>
+    using QueryRequired = typename TypeListConcat<typename QueryTerm<Terms>::required...>::type;
+
+    template<typename... Terms>
+    using QueryExcluded = typename TypeListConcat<typename QueryTerm<Terms>::excluded...>::type;
+} // namespace Engine::Core
+
+#endif /* !QUERYFILTERS_HPP_ */
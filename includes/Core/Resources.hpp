@@ -0,0 +1,125 @@
+#ifndef RESOURCES_HPP_
+#define RESOURCES_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include "QueryFilters.hpp"
+#include <boost/container/flat_set.hpp>
+
+namespace Engine::Core {
+
+    /**
+     * @brief Give each resource type a small index, the position of the resource in the World
+     */
+    class ResourceFamily final
+    {
+        public:
+            /**
+             * @brief Get the index of a resource type, the same for every World
+             *
+             * @tparam Resource The type of the resource
+             * @return std::size_t The index
+             */
+            template<typename Resource>
+            static std::size_t id()
+            {
+                static const std::size_t family = next();
+
+                return family;
+            }
+
+        private:
+            static std::size_t next()
+            {
+                static std::atomic<std::size_t> counter {0};
+
+                return counter++;
+            }
+    };
+
+    /**
+     * @brief The resources a system reads and writes
+     */
+    struct ResourceAccess
+    {
+            boost::container::flat_set<std::size_t> reads;
+            boost::container::flat_set<std::size_t> writes;
+
+            template<typename Resource>
+            ResourceAccess &read()
+            {
+                reads.insert(ResourceFamily::id<std::remove_cvref_t<Resource>>());
+                return *this;
+            }
+
+            template<typename Resource>
+            ResourceAccess &write()
+            {
+                writes.insert(ResourceFamily::id<std::remove_cvref_t<Resource>>());
+                return *this;
+            }
+
+            /**
+             * @brief Check if two systems can't run at the same time: one writes a resource the other uses
+             *
+             * @param aOther The access of the other system
+             * @return true if they conflict
+             */
+            [[nodiscard]] bool conflictsWith(const ResourceAccess &aOther) const
+            {
+                for (const auto family : writes) {
+                    if (aOther.reads.contains(family) || aOther.writes.contains(family)) {
+                        return true;
+                    }
+                }
+                for (const auto family : reads) {
+                    if (aOther.writes.contains(family)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+    };
+
+    template<typename Term>
+    struct ResourceTerm
+    {
+            static void declare(ResourceAccess & /*aAccess*/) {}
+    };
+
+    template<typename Resource>
+    struct ResourceTerm<Read<Resource>>
+    {
+            static void declare(ResourceAccess &aAccess)
+            {
+                aAccess.read<Resource>();
+            }
+    };
+
+    template<typename Resource>
+    struct ResourceTerm<Write<Resource>>
+    {
+            static void declare(ResourceAccess &aAccess)
+            {
+                aAccess.write<Resource>();
+            }
+    };
+
+    /**
+     * @brief Get the resources declared by the Read and Write terms of a query
+     *
+     * @tparam Terms The terms of the query
+     * @return ResourceAccess The resources read and written
+     */
+    template<typename... Terms>
+    ResourceAccess resourceAccessOf()
+    {
+        ResourceAccess access;
+
+        (ResourceTerm<Terms>::declare(access), ...);
+        return access;
+    }
+} // namespace Engine::Core
+
+#endif /* !RESOURCES_HPP_ */
@@ -0,0 +1,380 @@
+#ifndef SCRIPT_HPP_
+#define SCRIPT_HPP_
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <span>
+#include <typeindex>
+#include <utility>
+#include <vector>
+#include "Events/EventsManager.hpp"
+#include <boost/container/flat_map.hpp>
+
+namespace Engine::Core {
+    class ScriptScheduler;
+
+    /**
+     * @brief Recycle the coroutine frames of the scripts, per thread and per size class
+     * @details Frames bigger than maxPooledSize are allocated with operator new
+     */
+    class ScriptFramePool final
+    {
+        public:
+            static constexpr std::size_t granularity = 64;
+            static constexpr std::size_t maxPooledSize = 2048;
+
+            /**
+             * @brief Get a frame of at least the given size
+             *
+             * @param aSize The size of the frame
+             * @return void* The frame
+             */
+            static void *allocate(std::size_t aSize);
+
+            /**
+             * @brief Give back a frame got from allocate
+             *
+             * @param aFrame The frame
+             * @param aSize The size asked to allocate
+             */
+            static void deallocate(void *aFrame, std::size_t aSize) noexcept;
+    };
+
+    /**
+     * @brief A coroutine run by a ScriptScheduler, it can co_await nextFrame(), seconds(x) or event<T>()
+     * @details A script doesn't run until it is started, a script looping on nextFrame() acts as a system:
+     * @code
+     * Engine::Core::Script bossPattern(Engine::Core::World &world, std::size_t boss)
+     * {
+     *     while (true) {
+     *         co_await Engine::Core::seconds(2);
+     *         auto hit = co_await Engine::Core::event<BossHit>();
+     *         ...
+     *     }
+     * }
+     *
+     * world.startScript(boss, bossPattern(world, boss));
+     * @endcode
+     */
+    class Script final
+    {
+        public:
+            static constexpr std::size_t noEntity = std::numeric_limits<std::size_t>::max();
+
+            struct promise_type
+            {
+                    ScriptScheduler *scheduler = nullptr;
+                    std::exception_ptr error;
+                    std::size_t entity = noEntity;
+                    bool cancelled = false;
+
+                    static void *operator new(std::size_t aSize)
+                    {
+                        return ScriptFramePool::allocate(aSize);
+                    }
+
+                    static void operator delete(void *aFrame, std::size_t aSize) noexcept
+                    {
+                        ScriptFramePool::deallocate(aFrame, aSize);
+                    }
+
+                    Script get_return_object()
+                    {
+                        return Script(std::coroutine_handle<promise_type>::from_promise(*this));
+                    }
+
+                    std::suspend_always initial_suspend() noexcept
+                    {
+                        return {};
+                    }
+
+                    std::suspend_always final_suspend() noexcept
+                    {
+                        return {};
+                    }
+
+                    void return_void() noexcept {}
+
+                    void unhandled_exception() noexcept
+                    {
+                        error = std::current_exception();
+                    }
+            };
+
+            using handle = std::coroutine_handle<promise_type>;
+
+        private:
+            handle _handle;
+
+        public:
+#pragma region constructors / destructors
+            explicit Script(handle aHandle)
+                : _handle(aHandle)
+            {}
+
+            ~Script()
+            {
+                if (_handle) {
+                    _handle.destroy();
+                }
+            }
+
+            Script(const Script &other) = delete;
+            Script &operator=(const Script &other) = delete;
+
+            Script(Script &&other) noexcept
+                : _handle(std::exchange(other._handle, nullptr))
+            {}
+
+            Script &operator=(Script &&other) noexcept
+            {
+                if (this != &other) {
+                    if (_handle) {
+                        _handle.destroy();
+                    }
+                    _handle = std::exchange(other._handle, nullptr);
+                }
+                return *this;
+            }
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            /**
+             * @brief Give up the ownership of the coroutine
+             *
+             * @return handle The coroutine
+             */
+            handle release()
+            {
+                return std::exchange(_handle, nullptr);
+            }
+#pragma endregion methods
+    };
+
+    /**
+     * @brief Resume the suspended scripts when they are due, a suspended script costs nothing until then
+     * @details Scripts waiting for the next frame are resumed by the next update, then the timers that expired, then
+     * the scripts waiting for an event pushed since they suspended. A script bound to an entity is destroyed when the
+     * entity is cancelled, at the time it would have been resumed.
+     */
+    class ScriptScheduler final
+    {
+        public:
+            using handle = Script::handle;
+
+        private:
+            struct Timer
+            {
+                    double wakeTime;
+                    std::size_t order;
+                    handle script;
+
+                    bool operator>(const Timer &aOther) const
+                    {
+                        return wakeTime != aOther.wakeTime ? wakeTime > aOther.wakeTime : order > aOther.order;
+                    }
+            };
+
+            struct EventWaiter
+            {
+                    handle script;
+                    std::size_t seen;
+                    std::function<void(std::size_t)> deliver;
+            };
+
+            struct EventQueue
+            {
+                    std::function<std::size_t()> count;
+                    std::vector<EventWaiter> waiters;
+            };
+
+            double _time = 0;
+            std::size_t _timerOrder = 0;
+            std::size_t _scripts = 0;
+            std::vector<handle> _nextFrame;
+            std::priority_queue<Timer, std::vector<Timer>, std::greater<>> _timers;
+            boost::container::flat_map<std::type_index, EventQueue> _events;
+            boost::container::flat_multimap<std::size_t, handle> _entityScripts;
+
+        public:
+#pragma region constructors / destructors
+            ScriptScheduler() = default;
+
+            /**
+             * @brief Destroy every suspended script
+             */
+            ~ScriptScheduler();
+
+            ScriptScheduler(const ScriptScheduler &other) = delete;
+            ScriptScheduler &operator=(const ScriptScheduler &other) = delete;
+
+            ScriptScheduler(ScriptScheduler &&other) noexcept = delete;
+            ScriptScheduler &operator=(ScriptScheduler &&other) noexcept = delete;
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            /**
+             * @brief Run a script until its first suspension
+             * @throw The exception thrown by the script
+             * @param aScript The script
+             */
+            void start(Script &&aScript);
+
+            /**
+             * @brief Run a script bound to an entity until its first suspension
+             * @throw The exception thrown by the script
+             * @param aEntity The entity
+             * @param aScript The script
+             */
+            void start(std::size_t aEntity, Script &&aScript);
+
+            /**
+             * @brief Stop the scripts bound to an entity, they won't be resumed anymore
+             *
+             * @param aEntity The entity
+             */
+            void cancel(std::size_t aEntity);
+
+            /**
+             * @brief Move the scripts bound to entities to their new ids, e.g. after World::defragment
+             * @details The scripts of an entity without a new id are cancelled
+             *
+             * @param aRemap The new id of each old id, nullId for the dropped ones
+             */
+            void remap(std::span<const std::size_t> aRemap);
+
+            /**
+             * @brief Advance the time and resume the scripts that are due
+             * @throw The first exception thrown by a script, the others are still resumed
+             * @param aDeltaTime The time elapsed since the last update, in seconds
+             */
+            void update(double aDeltaTime);
+
+            /**
+             * @brief Get the number of scripts not done
+             *
+             * @return std::size_t The number of scripts
+             */
+            [[nodiscard]] std::size_t size() const;
+
+            /**
+             * @brief Get the time of the scheduler, the sum of the update delta times
+             *
+             * @return double The time, in seconds
+             */
+            [[nodiscard]] double getTime() const;
+
+            void waitNextFrame(handle aScript);
+            void waitSeconds(handle aScript, double aDuration);
+
+            template<typename EventType>
+            void waitEvent(handle aScript, std::optional<EventType> *aSlot)
+            {
+                auto &queue = _events[std::type_index(typeid(EventType))];
+
+                Event::EventManager::getInstance().initEventHandler<EventType>();
+                if (!queue.count) {
+                    queue.count = []() {
+                        return Event::EventManager::getInstance().getEventsByType<EventType>().size();
+                    };
+                }
+                queue.waiters.push_back(EventWaiter {aScript, queue.count(), [aSlot](std::size_t aIndex) {
+                                                         aSlot->emplace(Event::EventManager::getInstance()
+                                                                            .getEventsByType<EventType>()[aIndex]);
+                                                     }});
+            }
+#pragma endregion methods
+
+        private:
+            [[nodiscard]] std::exception_ptr resume(handle aScript);
+    };
+
+    struct NextFrameAwaiter
+    {
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(Script::handle aScript) const
+            {
+                aScript.promise().scheduler->waitNextFrame(aScript);
+            }
+
+            void await_resume() const noexcept {}
+    };
+
+    struct SecondsAwaiter
+    {
+            double duration;
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(Script::handle aScript) const
+            {
+                aScript.promise().scheduler->waitSeconds(aScript, duration);
+            }
+
+            void await_resume() const noexcept {}
+    };
+
+    template<typename EventType>
+    struct EventAwaiter
+    {
+            std::optional<EventType> received;
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(Script::handle aScript)
+            {
+                aScript.promise().scheduler->waitEvent<EventType>(aScript, &received);
+            }
+
+            EventType await_resume()
+            {
+                return std::move(*received);
+            }
+    };
+
+    /**
+     * @brief Suspend the script until the next update of its scheduler
+     */
+    inline NextFrameAwaiter nextFrame()
+    {
+        return {};
+    }
+
+    /**
+     * @brief Suspend the script for the given duration of scheduler time
+     *
+     * @param aDuration The duration, in seconds
+     */
+    inline SecondsAwaiter seconds(double aDuration)
+    {
+        return {aDuration};
+    }
+
+    /**
+     * @brief Suspend the script until an event of the given type is pushed, returns a copy of it
+     *
+     * @tparam EventType The type of the event
+     */
+    template<typename EventType>
+    EventAwaiter<EventType> event()
+    {
+        return {};
+    }
+} // namespace Engine::Core
+
+#endif /* !SCRIPT_HPP_ */
@@ -0,0 +1,41 @@
+#ifndef SIMD_HPP_
+#define SIMD_HPP_
+
+#include <span>
+
+namespace Engine::Simd {
+
+    /**
+     * @brief Name of the instruction set used by the kernels on this machine
+     *
+     * @return const char* "avx2", "neon" or "scalar"
+     */
+    const char *backendName();
+
+    /**
+     * @brief Integrate a field: aValues[i] += aRates[i] * aDelta
+     * @details Processes min(aValues.size(), aRates.size()) elements, 8 (AVX2) or 4 (NEON) at a time
+     * @param aValues The values to update, a SoA field (x, y...)
+     * @param aRates The rate of change of each value, a SoA field (dx, dy...)
+     * @param aDelta The time step
+     */
+    void integrate(std::span<float> aValues, std::span<const float> aRates, float aDelta);
+
+    /**
+     * @brief Scale a field: aValues[i] *= aFactor
+     *
+     * @param aValues The values to update
+     * @param aFactor The factor to apply
+     */
+    void scale(std::span<float> aValues, float aFactor);
+
+    /**
+     * @brief Scalar versions of the kernels, used for the tail of the arrays and as reference
+     */
+    namespace Scalar {
+        void integrate(std::span<float> aValues, std::span<const float> aRates, float aDelta);
+        void scale(std::span<float> aValues, float aFactor);
+    } // namespace Scalar
+} // namespace Engine::Simd
+
+#endif /* !SIMD_HPP_ */
@@ -0,0 +1,428 @@
+#ifndef SOAARRAY_HPP_
+#define SOAARRAY_HPP_
+
+#include <cstddef>
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "AlignedAllocator.hpp"
+#include "Exception.hpp"
+#include "MemoryStats.hpp"
+
+namespace Engine::Core {
+
+    DEFINE_EXCEPTION(SoAArrayException);
+    DEFINE_EXCEPTION_FROM(SoAArrayExceptionOutOfRange, SoAArrayException);
+    DEFINE_EXCEPTION_FROM(SoAArrayExceptionEmpty, SoAArrayException);
+
+    /**
+     * @brief Describe the fields of an aggregate component to store it as a structure of arrays
+     * @details Specialize it with a static constexpr tuple of member pointers named members, the World will then
+     * store the component in a SoAArray instead of a SparseArray:
+     * @code
+     * template<>
+     * struct Engine::Core::SoALayout<Position>
+     * {
+     *         static constexpr auto members = std::make_tuple(&Position::x, &Position::y);
+     * };
+     * @endcode
+     *
+     * @tparam Component The aggregate component
+     */
+    template<typename Component>
+    struct SoALayout;
+
+    template<typename Member>
+    struct SoAMemberType;
+
+    template<typename Component, typename Field>
+    struct SoAMemberType<Field Component::*>
+    {
+            using type = Field;
+    };
+
+    /**
+     * @brief SoAArray stores ONE component type field by field, one aligned array per field
+     * @details Each index represents the entity at the same index, like SparseArray. Empty slots keep a default
+     * constructed value in every field so kernels may run over a whole field array without checking the presence.
+     *
+     * @tparam Component The type of the components to store, needs a SoALayout specialization
+     */
+    template<typename Component>
+    class SoAArray final
+    {
+        public:
+            using members = std::remove_cv_t<decltype(SoALayout<Component>::members)>;
+            static constexpr std::size_t fieldCount = std::tuple_size_v<members>;
+
+            template<std::size_t Idx>
+            using fieldType = typename SoAMemberType<std::tuple_element_t<Idx, members>>::type;
+
+            template<typename Field>
+            using fieldArray = std::vector<Field, AlignedAllocator<Field>>;
+
+            using vectIndex = std::size_t;
+            using presenceArray = std::vector<std::uint8_t>;
+
+        private:
+            template<std::size_t... Idx>
+            static auto makeFields(std::index_sequence<Idx...> /*unused*/)
+                -> std::tuple<fieldArray<fieldType<Idx>>...>;
+
+            using fieldsTuple = decltype(makeFields(std::make_index_sequence<fieldCount> {}));
+
+            fieldsTuple _fields;
+            presenceArray _present;
+            std::uint64_t _presenceVersion = 0;
+
+        public:
+#pragma region constructors / destructors
+            SoAArray() = default;
+            ~SoAArray() = default;
+
+            SoAArray(const SoAArray &other) = default;
+            SoAArray &operator=(const SoAArray &other) = default;
+
+            SoAArray(SoAArray &&other) noexcept = default;
+            SoAArray &operator=(SoAArray &&other) noexcept = default;
+#pragma endregion constructors / destructors
+
+#pragma region methods
+
+            /**
+             * @brief Gather the component at the given index
+             * @throw SoAArrayExceptionOutOfRange if the index is out of range
+             * @throw SoAArrayExceptionEmpty if the component is empty
+             * @param aIndex The index to get
+             * @return Component A copy of the component at the given index
+             */
+            [[nodiscard]] Component get(vectIndex aIndex) const
+            {
+                checkIndex(aIndex);
+                if (_present[aIndex] == 0) {
+                    throw SoAArrayExceptionEmpty("index is empty: " + std::to_string(aIndex));
+                }
+                Component component {};
+
+                forEachField([&component, aIndex](auto aMember, auto &aField) {
+                    component.*aMember = aField[aIndex];
+                });
+                return component;
+            }
+
+            /**
+             * @brief Scatter the component at the given index
+             * @throw SoAArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The index to set
+             * @param aValue The value to set
+             */
+            void set(vectIndex aIndex, Component &&aValue)
+            {
+                checkIndex(aIndex);
+                store(aIndex, aValue);
+            }
+
+            /**
+             * @brief Check if the component at the given index is set
+             * @throw SoAArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The index to check
+             * @return true if the component is set
+             * @return false if the component is not set
+             */
+            [[nodiscard]] bool has(vectIndex aIndex) const
+            {
+                checkIndex(aIndex);
+                return _present[aIndex] != 0;
+            }
+
+            /**
+             * @brief Check if the component at the given index is set, without throwing
+             * @param aIndex The index to check
+             * @return true if the component is set
+             * @return false if the component is not set or the index is out of range
+             */
+            [[nodiscard]] bool contains(vectIndex aIndex) const
+            {
+                return aIndex < size() && _present[aIndex] != 0;
+            }
+
+            /**
+             * @brief Init the component at the given index, will resize every field if needed
+             * @param aIndex The index to init
+             */
+            void init(vectIndex aIndex)
+            {
+                if (aIndex >= size()) {
+                    resize(aIndex + 1);
+                }
+                reset(aIndex);
+            }
+
+            /**
+             * @brief Build and scatter the component at the given index, will resize every field if needed
+             * @param aIndex The index to set
+             * @param aArgs The arguments used to build the component
+             * @return Component A copy of the component inserted
+             */
+            template<typename... Args>
+            Component emplace(vectIndex aIndex, Args &&...aArgs)
+            {
+                if (aIndex >= size()) {
+                    resize(aIndex + 1);
+                }
+                Component component {std::forward<Args>(aArgs)...};
+
+                store(aIndex, component);
+                return component;
+            }
+
+            /**
+             * @brief Erase the component at the given index, fields go back to their default value, won't resize
+             * @throw SoAArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The index to erase
+             */
+            void erase(vectIndex aIndex)
+            {
+                checkIndex(aIndex);
+                reset(aIndex);
+            }
+
+            /**
+             * @brief Move the component of an index to another one, the first index goes back to default values
+             * @details Nothing is moved if the first index is out of range, every field grows to fit the second one
+             * @param aFrom The index to move from
+             * @param aTo The index to move to
+             */
+            void relocate(vectIndex aFrom, vectIndex aTo)
+            {
+                if (aFrom >= size() || aFrom == aTo) {
+                    return;
+                }
+                if (aTo >= size()) {
+                    resize(aTo + 1);
+                }
+                forEachField([aFrom, aTo](auto /*aMember*/, auto &aField) {
+                    aField[aTo] = std::move(aField[aFrom]);
+                    aField[aFrom] = {};
+                });
+                _present[aTo] = _present[aFrom];
+                _present[aFrom] = 0;
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Destroy all the components
+             */
+            void clear()
+            {
+                std::apply(
+                    [](auto &...aField) {
+                        (aField.clear(), ...);
+                    },
+                    _fields);
+                _present.clear();
+                _presenceVersion++;
+            }
+
+            [[nodiscard]] vectIndex size() const
+            {
+                return _present.size();
+            }
+
+            /**
+             * @brief Remove the trailing empty slots, never below aSize, and release the unused memory
+             * @param aSize The minimum size to keep
+             */
+            void shrinkToFit(vectIndex aSize)
+            {
+                auto newSize = size();
+
+                while (newSize > aSize && _present[newSize - 1] == 0) {
+                    newSize--;
+                }
+                resize(newSize);
+                std::apply(
+                    [](auto &...aField) {
+                        (aField.shrink_to_fit(), ...);
+                    },
+                    _fields);
+                _present.shrink_to_fit();
+            }
+
+            /**
+             * @brief Remove all the trailing empty slots and release the unused memory
+             * @return vectIndex The new size
+             */
+            vectIndex compact()
+            {
+                shrinkToFit(0);
+                return size();
+            }
+
+            /**
+             * @brief Get the memory used by the fields
+             * @return MemoryStats The memory used
+             */
+            [[nodiscard]] MemoryStats memoryStats() const
+            {
+                const auto live = static_cast<std::size_t>(std::count(_present.begin(), _present.end(), 1));
+                std::size_t reserved = _present.capacity();
+                std::size_t slotSize = 0;
+
+                std::apply(
+                    [&reserved, &slotSize](const auto &...aField) {
+                        ((reserved += aField.capacity() * sizeof(aField[0]), slotSize += sizeof(aField[0])), ...);
+                    },
+                    _fields);
+                return MemoryStats {reserved, live * slotSize, size(), live};
+            }
+
+            /**
+             * @brief Get the version of the set of filled slots, changed by each call adding or removing a component
+             * @details Lets the World notice the components added or removed through the storage instead of its own
+             * API
+             * @return std::uint64_t The version
+             */
+            [[nodiscard]] std::uint64_t presenceVersion() const
+            {
+                return _presenceVersion;
+            }
+
+            /**
+             * @brief Get the whole array of one field, including the empty slots
+             *
+             * @tparam Idx The index of the field in SoALayout<Component>::members
+             * @return std::span<fieldType<Idx>> The field array, aligned on 64 bytes
+             */
+            template<std::size_t Idx>
+            std::span<fieldType<Idx>> field()
+            {
+                return std::span<fieldType<Idx>>(std::get<Idx>(_fields));
+            }
+
+            template<std::size_t Idx>
+            [[nodiscard]] std::span<const fieldType<Idx>> field() const
+            {
+                return std::span<const fieldType<Idx>>(std::get<Idx>(_fields));
+            }
+
+            /**
+             * @brief Get the presence flags, 1 if the slot holds a component, 0 otherwise
+             *
+             * @return std::span<const std::uint8_t> The presence flags
+             */
+            [[nodiscard]] std::span<const std::uint8_t> presence() const
+            {
+                return std::span<const std::uint8_t>(_present);
+            }
+
+            /**
+             * @brief Call aFunc for each contiguous run of set components
+             * @details aFunc receives the index of the first entity of the run then one span per field, all of the
+             * same length, so a kernel can process the run without any presence check
+             * @param aFunc The function to call, void(std::size_t, std::span<Fields>...)
+             */
+            template<typename Func>
+            void forEachBatch(Func &&aFunc)
+            {
+                const auto count = size();
+
+                for (vectIndex first = 0; first < count;) {
+                    if (_present[first] == 0) {
+                        first++;
+                        continue;
+                    }
+                    vectIndex last = first;
+
+                    while (last < count && _present[last] != 0) {
+                        last++;
+                    }
+                    callBatch(aFunc, first, last - first, std::make_index_sequence<fieldCount> {});
+                    first = last;
+                }
+            }
+
+#pragma endregion methods
+
+        private:
+            void checkIndex(vectIndex aIndex) const
+            {
+                if (aIndex >= size()) {
+                    throw SoAArrayExceptionOutOfRange("index out of range: " + std::to_string(aIndex));
+                }
+            }
+
+            template<typename Func>
+            void forEachField(Func &&aFunc)
+            {
+                forEachField(aFunc, std::make_index_sequence<fieldCount> {});
+            }
+
+            template<typename Func>
+            void forEachField(Func &&aFunc) const
+            {
+                forEachField(aFunc, std::make_index_sequence<fieldCount> {});
+            }
+
+            template<typename Func, std::size_t... Idx>
+            void forEachField(Func &aFunc, std::index_sequence<Idx...> /*unused*/)
+            {
+                (aFunc(std::get<Idx>(SoALayout<Component>::members), std::get<Idx>(_fields)), ...);
+            }
+
+            template<typename Func, std::size_t... Idx>
+            void forEachField(Func &aFunc, std::index_sequence<Idx...> /*unused*/) const
+            {
+                (aFunc(std::get<Idx>(SoALayout<Component>::members), std::get<Idx>(_fields)), ...);
+            }
+
+            template<typename Func, std::size_t... Idx>
+            void callBatch(Func &aFunc, vectIndex aFirst, vectIndex aCount, std::index_sequence<Idx...> /*unused*/)
+            {
+                aFunc(aFirst, std::span<fieldType<Idx>>(std::get<Idx>(_fields).data() + aFirst, aCount)...);
+            }
+
+            void store(vectIndex aIndex, const Component &aValue)
+            {
+                forEachField([&aValue, aIndex](auto aMember, auto &aField) {
+                    aField[aIndex] = aValue.*aMember;
+                });
+                _present[aIndex] = 1;
+                _presenceVersion++;
+            }
+
+            void reset(vectIndex aIndex)
+            {
+                forEachField([aIndex](auto /*aMember*/, auto &aField) {
+                    aField[aIndex] = {};
+                });
+                _present[aIndex] = 0;
+                _presenceVersion++;
+            }
+
+            void resize(vectIndex aSize)
+            {
+                std::apply(
+                    [aSize](auto &...aField) {
+                        (aField.resize(aSize), ...);
+                    },
+                    _fields);
+                _present.resize(aSize, 0);
+            }
+    };
+
+    template<typename Storage>
+    struct IsSoAArray : std::false_type
+    {};
+
+    template<typename Component>
+    struct IsSoAArray<SoAArray<Component>> : std::true_type
+    {};
+} // namespace Engine::Core
+
+#endif /* !SOAARRAY_HPP_ */
@@ -5,10 +5,14 @@
 #ifndef SPARSEARRAY_HPP_
 #define SPARSEARRAY_HPP_
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <vector>
 #include "Exception.hpp"
+#include "MemoryStats.hpp"
 
 namespace Engine::Core {
 
@@ -38,6 +42,7 @@ namespace Engine::Core {
 
         private:
             vectArray _array;
+            std::uint64_t _presenceVersion = 0;
 
         public:
 #pragma region constructors / destructors
@@ -111,6 +116,44 @@ namespace Engine::Core {
                 return _array[aIndex].value();
             }
 
+            constCompRef get(vectIndex aIndex) const
+            {
+                return (*this)[aIndex];
+            }
+
+            /**
+             * @brief Get the component of the given entity without throwing
+             * @param aIndex The entity
+             * @return Component * The component, nullptr if the index is out of range or empty
+             */
+            Component *tryGet(vectIndex aIndex)
+            {
+                return aIndex < _array.size() && _array[aIndex].has_value() ? &*_array[aIndex] : nullptr;
+            }
+
+            [[nodiscard]] const Component *tryGet(vectIndex aIndex) const
+            {
+                return aIndex < _array.size() && _array[aIndex].has_value() ? &*_array[aIndex] : nullptr;
+            }
+
+            /**
+             * @brief Get the component of the given entity, only checked by an assertion in debug builds
+             * @details For the callers that already know the entity has it, e.g. from its signature
+             * @param aIndex The entity
+             * @return compRef The component of the entity
+             */
+            compRef getUnchecked(vectIndex aIndex)
+            {
+                assert(aIndex < _array.size() && _array[aIndex].has_value());
+                return *_array[aIndex];
+            }
+
+            constCompRef getUnchecked(vectIndex aIndex) const
+            {
+                assert(aIndex < _array.size() && _array[aIndex].has_value());
+                return *_array[aIndex];
+            }
+
             /**
              * @brief Set the component at the given index
              * @throw SparseArrayExceptionOutOfRange if the index is out of range
@@ -123,6 +166,7 @@ namespace Engine::Core {
                     throw SparseArrayExceptionOutOfRange("index out of range: " + std::to_string(aIndex));
                 }
                 _array[aIndex] = std::move(aValue);
+                _presenceVersion++;
             }
 
             /**
@@ -140,6 +184,17 @@ namespace Engine::Core {
                 return _array[aIndex].has_value();
             }
 
+            /**
+             * @brief Check if the component at the given index is set, without throwing
+             * @param aIndex The index to check
+             * @return true if the component is set
+             * @return false if the component is not set or the index is out of range
+             */
+            [[nodiscard]] bool contains(vectIndex aIndex) const
+            {
+                return aIndex < _array.size() && _array[aIndex].has_value();
+            }
+
             /**
              * @brief Init the component at the given index, will resize the array if needed and set each value to
              * std::nullopt
@@ -151,6 +206,7 @@ namespace Engine::Core {
                     _array.resize(aIndex + 1, std::nullopt);
                 }
                 _array[aIndex] = std::nullopt;
+                _presenceVersion++;
             }
 
             /**
@@ -167,6 +223,7 @@ namespace Engine::Core {
                     _array.resize(aIndex + 1);
                 }
                 _array[aIndex].emplace(Component(std::forward<Args>(aArgs)...));
+                _presenceVersion++;
                 return _array[aIndex].value();
             }
 
@@ -182,6 +239,7 @@ namespace Engine::Core {
                     throw SparseArrayExceptionOutOfRange("index out of range: " + std::to_string(aIndex));
                 }
                 _array[aIndex].reset();
+                _presenceVersion++;
             }
 
             /**
@@ -190,6 +248,77 @@ namespace Engine::Core {
             void clear()
             {
                 _array.clear();
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Move the component of an index to another one, the first index becomes empty
+             * @details Nothing is moved if the first index is out of range, the array grows to fit the second one
+             * @param aFrom The index to move from
+             * @param aTo The index to move to
+             */
+            void relocate(vectIndex aFrom, vectIndex aTo)
+            {
+                if (aFrom >= _array.size() || aFrom == aTo) {
+                    return;
+                }
+                if (aTo >= _array.size()) {
+                    _array.resize(aTo + 1);
+                }
+                _array[aTo] = std::move(_array[aFrom]);
+                _array[aFrom].reset();
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Remove the trailing empty slots, never below aSize, and release the unused memory
+             * @param aSize The minimum size to keep
+             */
+            void shrinkToFit(vectIndex aSize)
+            {
+                auto newSize = _array.size();
+
+                while (newSize > aSize && !_array[newSize - 1].has_value()) {
+                    newSize--;
+                }
+                _array.erase(_array.begin() + static_cast<std::ptrdiff_t>(newSize), _array.end());
+                _array.shrink_to_fit();
+            }
+
+            /**
+             * @brief Remove all the trailing empty slots and release the unused memory
+             * @return vectIndex The new size
+             */
+            vectIndex compact()
+            {
+                shrinkToFit(0);
+                return _array.size();
+            }
+
+            /**
+             * @brief Get the memory used by the array
+             * @return MemoryStats The memory used, a slot is an std::optional<Component>
+             */
+            [[nodiscard]] MemoryStats memoryStats() const
+            {
+                const auto live = static_cast<std::size_t>(std::count_if(_array.begin(), _array.end(),
+                                                                         [](const optComponent &aSlot) {
+                                                                             return aSlot.has_value();
+                                                                         }));
+
+                return MemoryStats {_array.capacity() * sizeof(optComponent), live * sizeof(Component), _array.size(),
+                                    live};
+            }
+
+            /**
+             * @brief Get the version of the set of filled slots, changed by each call adding or removing a component
+             * @details Lets the World notice the components added or removed through the storage instead of its own
+             * API. Filling or emptying a slot through the iterators isn't counted
+             * @return std::uint64_t The version
+             */
+            [[nodiscard]] std::uint64_t presenceVersion() const
+            {
+                return _presenceVersion;
             }
 
 #pragma endregion methods
@@ -0,0 +1,195 @@
+#ifndef STATEHASH_HPP_
+#define STATEHASH_HPP_
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Engine::Core {
+
+    class World;
+
+    /**
+     * @brief Hash a buffer with FNV-1a, the result doesn't depend on the platform nor on the run
+     *
+     * @param aData The buffer
+     * @param aSize The size of the buffer in bytes
+     * @return std::uint64_t The hash
+     */
+    std::uint64_t hashBytes(const void *aData, std::size_t aSize);
+
+    /**
+     * @brief Scramble the bits of a value (splitmix64 finalizer)
+     *
+     * @param aValue The value
+     * @return std::uint64_t The scrambled value
+     */
+    std::uint64_t mixHash(std::uint64_t aValue);
+
+    /**
+     * @brief Find the first slot two lists of slot hashes differ on, the missing slots are empty ones
+     *
+     * @param aFirst The slot hashes of a storage
+     * @param aSecond The slot hashes of the same storage on another peer
+     * @return std::size_t The first diverging slot, the max size_t if they are the same
+     */
+    std::size_t findDivergence(std::span<const std::uint64_t> aFirst, std::span<const std::uint64_t> aSecond);
+
+    /**
+     * @brief Deterministic hash of a component, used by the state hashes of the World
+     * @details Defaults to the bytes of the components whose bytes are their value
+     * (std::has_unique_object_representations: no padding, no floating point) and to 0 for the empty ones.
+     * Specialize it for the other components, e.g. hashing each member:
+     * @code
+     * template<>
+     * struct Engine::Core::ComponentHash<Name>
+     * {
+     *         std::uint64_t operator()(const Name &aName) const
+     *         {
+     *             return Engine::Core::hashBytes(aName.value.data(), aName.value.size());
+     *         }
+     * };
+     * @endcode
+     *
+     * @tparam Component The type of the component
+     */
+    template<typename Component, typename = void>
+    struct ComponentHash
+    {};
+
+    template<typename Component>
+    struct ComponentHash<Component, std::enable_if_t<std::is_empty_v<Component>
+                                                     || std::has_unique_object_representations_v<Component>>>
+    {
+            std::uint64_t operator()(const Component &aComponent) const
+            {
+                if constexpr (std::is_empty_v<Component>) {
+                    return 0;
+                } else {
+                    return hashBytes(&aComponent, sizeof(Component));
+                }
+            }
+    };
+
+    template<typename Component>
+    concept HashableComponent = requires(const Component &aComponent) {
+        {
+            ComponentHash<Component> {}(aComponent)
+        } -> std::convertible_to<std::uint64_t>;
+    };
+
+    /**
+     * @brief Incremental hash of one component storage: the sum of the hashes of its slots
+     * @details The written slots are only flagged and listed, flush rehashes the listed ones so it costs the
+     * number of written slots, not the number of entities. Flagging a slot already in range is safe from several
+     * threads as long as they flag different slots
+     */
+    class StateHash
+    {
+        public:
+            using slotFunc = std::function<std::uint64_t(const World &, std::size_t)>;
+
+        private:
+            slotFunc _slot;
+            std::vector<std::uint64_t> _slots;
+            std::vector<std::uint8_t> _written;
+            std::vector<std::size_t> _dirty;
+            alignas(std::atomic_ref<std::size_t>::required_alignment) std::size_t _dirtyCount = 0;
+            std::uint64_t _digest = 0;
+
+        public:
+#pragma region constructors / destructors
+            StateHash() = default;
+            ~StateHash() = default;
+
+            StateHash(const StateHash &other) = default;
+            StateHash &operator=(const StateHash &other) = default;
+
+            StateHash(StateHash &&other) noexcept = default;
+            StateHash &operator=(StateHash &&other) noexcept = default;
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            /**
+             * @brief Start hashing a storage, all its slots are flagged
+             *
+             * @param aSlot Hash of a slot, 0 for an empty one
+             * @param aSize The number of slots
+             */
+            void track(slotFunc aSlot, std::size_t aSize);
+
+            /**
+             * @brief Check if a storage is hashed
+             *
+             * @return true if track was called
+             * @return false otherwise
+             */
+            [[nodiscard]] bool isTracked() const;
+
+            /**
+             * @brief Grow to hold a number of slots, call it before flagging slots from several threads
+             *
+             * @param aSize The number of slots
+             */
+            void reserve(std::size_t aSize);
+
+            /**
+             * @brief Flag a slot as written, growing if needed
+             *
+             * @param aIndex The slot
+             */
+            void markWritten(std::size_t aIndex)
+            {
+                if (aIndex >= _written.size()) {
+                    reserve(aIndex + 1);
+                }
+                if (_written[aIndex] == 0) {
+                    _written[aIndex] = 1;
+                    _dirty[std::atomic_ref<std::size_t>(_dirtyCount).fetch_add(1, std::memory_order_relaxed)] = aIndex;
+                }
+            }
+
+            /**
+             * @brief Flag all the slots, e.g. after the entities were moved
+             *
+             * @param aSize The number of slots
+             */
+            void markAll(std::size_t aSize);
+
+            /**
+             * @brief Rehash the written slots
+             *
+             * @param aWorld The World owning the storage
+             */
+            void flush(const World &aWorld);
+
+            /**
+             * @brief Drop the slots past a size, after a flush
+             *
+             * @param aSize The number of slots to keep
+             */
+            void shrinkToFit(std::size_t aSize);
+
+            /**
+             * @brief Get the hash of the storage, as of the last flush
+             *
+             * @return std::uint64_t The hash
+             */
+            [[nodiscard]] std::uint64_t digest() const;
+
+            /**
+             * @brief Get the hash of each slot, as of the last flush, to find the entity two storages differ on
+             *
+             * @return std::span<const std::uint64_t> The hashes
+             */
+            [[nodiscard]] std::span<const std::uint64_t> slotHashes() const;
+#pragma endregion methods
+    };
+} // namespace Engine::Core
+
+#endif /* !STATEHASH_HPP_ */
@@ -0,0 +1,435 @@
+#ifndef STATICWORLD_HPP_
+#define STATICWORLD_HPP_
+
+#include <algorithm>
+#include <any>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+#include "ComponentStorage.hpp"
+#include "JobSystem.hpp"
+#include "QueryFilters.hpp"
+#include "Systems/GenericSystem.hpp"
+#include "World.hpp"
+
+namespace Engine::Core {
+
+    /**
+     * @brief Get the position of a component in a list
+     *
+     * @tparam Component The component
+     * @tparam Components The list
+     * @return std::size_t The position, the size of the list if the component isn't in it
+     */
+    template<typename Component, typename... Components>
+    consteval std::size_t componentIndexOf()
+    {
+        constexpr std::array<bool, sizeof...(Components)> matches {std::is_same_v<Component, Components>...};
+
+        for (std::size_t idx = 0; idx < matches.size(); idx++) {
+            if (matches[idx]) {
+                return idx;
+            }
+        }
+        return sizeof...(Components);
+    }
+
+    template<typename... Components, std::size_t... Idx>
+    consteval bool areComponentsUnique(std::index_sequence<Idx...> /*unused*/)
+    {
+        return ((componentIndexOf<Components, Components...>() == Idx) && ...);
+    }
+
+    /**
+     * @brief A World whose components are fixed at compile time
+     * @details The components are registered by the constructor, in order, so the bit of a component is its position
+     * in the list. The storages are held in a tuple: getComponent, spawning, killing and adding or removing a
+     * component resolve the storage at compile time instead of going through the type erased storages of the World,
+     * and the queries of a StaticWorld match the entities on constant masks and call their callback directly, without
+     * a std::function.
+     * It is still a World: it can be added to an App, given to the systems, forked, and the code taking a World
+     * reference goes through the generic paths of the World on the same state.
+     * The list of components can't change: registering or removing a component doesn't compile on a StaticWorld and
+     * throws WorldExceptionComponentsFrozen through a World reference.
+     *
+     * @tparam Components The components of the World, each one once
+     */
+    template<typename... Components>
+    class StaticWorld final : public World
+    {
+            static_assert(sizeof...(Components) <= maxComponents, "Too many components");
+            static_assert(areComponentsUnique<Components...>(std::index_sequence_for<Components...> {}),
+                          "A component is listed twice");
+
+        public:
+            using mask = std::uint64_t;
+
+            /**
+             * @brief Get the bit of a component, its position in the list
+             */
+            template<typename Component>
+            static consteval std::size_t getComponentBit()
+            {
+                constexpr auto bit = componentIndexOf<Component, Components...>();
+
+                static_assert(bit < sizeof...(Components), "Component not in the StaticWorld");
+                return bit;
+            }
+
+            /**
+             * @brief Build the mask made of the bits of the components
+             */
+            template<typename... Listed>
+            static constexpr mask maskOf(TypeList<Listed...> /*unused*/)
+            {
+                return (mask {0} | ... | (mask {1} << getComponentBit<Listed>()));
+            }
+
+            /**
+             * @brief Iterate over the entities matching a list of terms, the terms of World::Query
+             * @details The callback is a template parameter called directly, it receives the World like the callbacks
+             * of World::Query so the same callbacks work on both
+             *
+             * @tparam Terms The terms of the query
+             */
+            template<typename... Terms>
+            class StaticQuery
+            {
+                public:
+                    explicit StaticQuery(StaticWorld &aWorld)
+                        : _world(aWorld)
+                    {}
+
+                    template<typename Func>
+                    void forEach(double deltaTime, Func &&func)
+                    {
+                        auto &world = _world.get();
+
+                        world.syncPresence();
+                        [[maybe_unused]] const auto processed = forEachIn(0, world.getCurrentId(), deltaTime, func);
+
+#ifdef ENGINE_PROFILING
+                        world._processedEntities += processed;
+#endif
+                    }
+
+                    /**
+                     * @brief Split the entities into jobs run by a job system, the callback must be safe to call from
+                     * several threads at once
+                     *
+                     * @param deltaTime The time given to the callback
+                     * @param func The callback
+                     * @param grain The number of entity ids per job
+                     * @param jobs The job system, the engine one by default
+                     */
+                    template<typename Func>
+                    void forEachParallel(double deltaTime, Func &&func, std::size_t grain = defaultParallelGrain,
+                                         JobSystem &jobs = JobSystem::getInstance())
+                    {
+                        std::atomic<std::size_t> processed {0};
+
+                        _world.get().syncPresence();
+                        // the jobs must not copy the storages still shared with a fork
+                        [[maybe_unused]] const std::tuple<TermFetcher<Terms>...> unshared {
+                            TermFetcher<Terms>(_world.get())...};
+
+                        jobs.parallelFor(_world.get().getCurrentId(), grain,
+                                         [this, deltaTime, &func, &processed](std::size_t aBegin, std::size_t aEnd) {
+                                             processed += forEachIn(aBegin, aEnd, deltaTime, func);
+                                         });
+#ifdef ENGINE_PROFILING
+                        _world.get()._processedEntities += processed.load();
+#endif
+                    }
+
+                    /**
+                     * @brief Iterate over the matched entities whose id is in a range, e.g. a slice of the entities
+                     *
+                     * @param aBegin The first id
+                     * @param aEnd The id past the last one, clamped to the current id
+                     * @param deltaTime The time given to the callback
+                     * @param func The callback
+                     * @return std::size_t The number of entities processed
+                     */
+                    template<typename Func>
+                    std::size_t forEachRange(std::size_t aBegin, std::size_t aEnd, double deltaTime, Func &&func)
+                    {
+                        auto &world = _world.get();
+
+                        world.syncPresence();
+                        const auto processed =
+                            forEachIn(aBegin, std::min(aEnd, world.getCurrentId()), deltaTime, func);
+
+#ifdef ENGINE_PROFILING
+                        world._processedEntities += processed;
+#endif
+                        return processed;
+                    }
+
+                private:
+                    static constexpr mask required = maskOf(QueryRequired<Terms...> {});
+                    static constexpr mask excluded = maskOf(QueryExcluded<Terms...> {});
+
+                    template<typename Func>
+                    std::size_t forEachIn(std::size_t aBegin, std::size_t aEnd, double deltaTime, Func &func)
+                    {
+                        auto &world = _world.get();
+                        World &base = world;
+                        std::tuple<TermFetcher<Terms>...> fetchers {TermFetcher<Terms>(world)...};
+                        std::size_t processed = 0;
+
+                        for (std::size_t idx = aBegin; idx < aEnd; idx++) {
+                            const auto &entitySignature = world._signatures[idx];
+                            const auto bits = static_cast<mask>(entitySignature.to_ullong());
+
+                            if ((bits & required) != required || (bits & excluded) != 0
+                                || (required == 0 && !world.isAlive(idx))) {
+                                continue;
+                            }
+                            processed++;
+                            std::apply(
+                                [&](auto &...aFetcher) {
+                                    std::apply(func, std::tuple_cat(std::forward_as_tuple(base, deltaTime, idx),
+                                                                    aFetcher.fetch(entitySignature, idx)...));
+                                },
+                                fetchers);
+                        }
+                        return processed;
+                    }
+
+                    std::reference_wrapper<StaticWorld> _world;
+            };
+
+#pragma region constructors / destructors
+            StaticWorld()
+            {
+                World::registerComponents<Components...>();
+                _frozen = true;
+                cacheStorages();
+            }
+
+            ~StaticWorld() override = default;
+
+            StaticWorld(const StaticWorld &other) = delete;
+            StaticWorld &operator=(const StaticWorld &other) = delete;
+
+            StaticWorld(StaticWorld &&other) noexcept
+                : World(std::move(other))
+            {
+                cacheStorages();
+            }
+
+            StaticWorld &operator=(StaticWorld &&other) noexcept
+            {
+                World::operator=(std::move(other));
+                cacheStorages();
+                return *this;
+            }
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            template<typename Component>
+            StorageOf<Component> &registerComponent() = delete;
+
+            template<typename... Others>
+            void registerComponents() = delete;
+
+            template<typename Component>
+            void removeComponent() = delete;
+
+            /**
+             * @brief Get the storage of a component, resolved at compile time
+             * @details The storage is copied first if it's still shared with a fork
+             *
+             * @tparam Component The type of the component
+             * @return StorageOf<Component>& the storage of the component
+             */
+            template<typename Component>
+            StorageOf<Component> &getComponent()
+            {
+                auto &storage = *std::get<getComponentBit<Component>()>(_storages);
+
+                if (storage.use_count() > 1) {
+                    storage = std::make_shared<StorageOf<Component>>(std::as_const(*storage));
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return *storage;
+            }
+
+            template<typename Component>
+            StorageOf<Component> const &getComponent() const
+            {
+                return *std::get<getComponentBit<Component>()>(_storages)->get();
+            }
+
+            /**
+             * @brief Iterate over the entities matching a list of terms, without type erasure
+             *
+             * @tparam Terms Components, With<...>, Without<...>, Optional<...>, Previous<...>, Read<...> or Write<...>
+             * @return StaticQuery<Terms...> The query
+             */
+            template<typename... Terms>
+            StaticQuery<Terms...> query()
+            {
+                return StaticQuery<Terms...>(*this);
+            }
+
+            using World::createEntity;
+
+            /**
+             * @brief Create an entity, its components are initialized without type erasure
+             *
+             * @return std::size_t The id of the entity
+             */
+            std::size_t createEntity()
+            {
+                const auto newIdx = allocateEntity();
+
+                (initComponent<Components>(newIdx), ...);
+                updateQueryCaches(newIdx, signature {}.set());
+                return newIdx;
+            }
+
+            /**
+             * @brief Kill an entity, its components are erased without type erasure
+             *
+             * @param aIndex The index of the entity to kill
+             */
+            void killEntity(std::size_t aIndex)
+            {
+                releaseEntity(aIndex);
+                (eraseComponent<Components>(aIndex), ...);
+            }
+
+            /**
+             * @brief Add a component to an entity
+             *
+             * @tparam Component The type of the component to add
+             * @param aIndex The index of the entity
+             * @param aComponent The component to add
+             * @return decltype(auto) The component added, a copy for the SoA components
+             */
+            template<typename Component>
+            decltype(auto) addComponentToEntity(std::size_t aIndex, Component &&aComponent)
+            {
+                auto &component = getComponent<Component>();
+                const auto before = component.presenceVersion();
+
+                component.set(aIndex, std::forward<Component>(aComponent));
+                acknowledgePresence(getComponentBit<Component>(), before, component.presenceVersion());
+                componentAdded(getComponentBit<Component>(), aIndex);
+                return component.get(aIndex);
+            }
+
+            /**
+             * @brief Build and add a component to an entity
+             *
+             * @tparam Component The type of the component to add
+             * @param aIndex The index of the entity
+             * @param aArgs The arguments to pass to the component constructor
+             * @return decltype(auto) The component added, a copy for the SoA components
+             */
+            template<typename Component, typename... Args>
+            decltype(auto) emplaceComponentToEntity(std::size_t aIndex, Args &&...aArgs)
+            {
+                auto &component = getComponent<Component>();
+                const auto before = component.presenceVersion();
+
+                component.emplace(aIndex, std::forward<Args>(aArgs)...);
+                acknowledgePresence(getComponentBit<Component>(), before, component.presenceVersion());
+                componentAdded(getComponentBit<Component>(), aIndex);
+                return component.get(aIndex);
+            }
+
+            /**
+             * @brief Remove a component from an entity
+             *
+             * @tparam Component The type of the component to remove
+             * @param aIndex The index of the entity
+             */
+            template<typename Component>
+            void removeComponentFromEntity(std::size_t aIndex)
+            {
+                auto &component = getComponent<Component>();
+                const auto before = component.presenceVersion();
+
+                componentRemoved(getComponentBit<Component>(), aIndex);
+                component.erase(aIndex);
+                acknowledgePresence(getComponentBit<Component>(), before, component.presenceVersion());
+            }
+
+            /**
+             * @brief Fork the World, the fork is a StaticWorld of the same components
+             *
+             * @return StaticWorld The fork
+             */
+            [[nodiscard]] StaticWorld fork() const
+            {
+                return StaticWorld(World::fork());
+            }
+#pragma endregion methods
+
+        private:
+            std::tuple<std::shared_ptr<StorageOf<Components>> *...> _storages;
+
+            explicit StaticWorld(World &&aWorld)
+                : World(std::move(aWorld))
+            {
+                _frozen = true;
+                cacheStorages();
+            }
+
+            template<typename Component>
+            void initComponent(std::size_t aIndex)
+            {
+                auto &component = getComponent<Component>();
+                const auto before = component.presenceVersion();
+
+                component.init(aIndex);
+                acknowledgePresence(getComponentBit<Component>(), before, component.presenceVersion());
+            }
+
+            template<typename Component>
+            void eraseComponent(std::size_t aIndex)
+            {
+                auto &component = getComponent<Component>();
+                const auto before = component.presenceVersion();
+
+                component.erase(aIndex);
+                acknowledgePresence(getComponentBit<Component>(), before, component.presenceVersion());
+            }
+
+            void cacheStorages()
+            {
+                _storages = std::make_tuple(std::any_cast<std::shared_ptr<StorageOf<Components>>>(
+                    &_components.find(std::type_index(typeid(Components)))->second.first)...);
+            }
+    };
+
+    /**
+     * @brief Create a system running a callback on a query of a StaticWorld, the callback is called directly
+     *
+     * @tparam Terms The terms of the query
+     * @param aWorld The World
+     * @param aName The name of the system
+     * @param aUpdateFunc The callback, taking the same arguments as the ones of a World query
+     */
+    template<typename... Terms, typename... Components, typename Func>
+    std::pair<std::string, std::unique_ptr<System>> createSystem(StaticWorld<Components...> &aWorld,
+                                                                 const std::string &aName, Func aUpdateFunc)
+    {
+        return std::pair<std::string, std::unique_ptr<System>>(std::make_pair(
+            aName,
+            std::make_unique<BasicGenericSystem<StaticWorld<Components...>, Func, Terms...>>(aWorld, aUpdateFunc)));
+    }
+} // namespace Engine::Core
+
+#endif /* !STATICWORLD_HPP_ */
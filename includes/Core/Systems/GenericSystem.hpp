@@ -1,6 +1,9 @@
 #ifndef GENERICSYSTEM_HPP_
 #define GENERICSYSTEM_HPP_
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <functional>
 #include <utility>
 #include "Core/Clock.hpp"
@@ -8,27 +11,70 @@
 #include "System.hpp"
 
 namespace Engine::Core {
-    template<typename Func, typename... Components>
-    class GenericSystem : public System
+    /**
+     * @brief A system running a callback on the entities of a query
+     *
+     * @tparam WorldType The World, or a StaticWorld whose queries call the callback without type erasure
+     * @tparam Func The callback
+     * @tparam Components The terms of the query
+     */
+    template<typename WorldType, typename Func, typename... Components>
+    class BasicGenericSystem : public System
     {
         public:
-            GenericSystem(Core::World &world, Func updateFunc)
+            BasicGenericSystem(WorldType &world, Func updateFunc)
                 : _world(world),
                   _updateFunc(updateFunc)
-            {}
+            {
+                _resourceAccess = resourceAccessOf<Components...>();
+            }
 
+            /**
+             * @brief Run the callback on the matched entities, or on the next slice of them for the time-sliced
+             * systems, until the time budget is spent
+             * @details deltaTime is the time since the last run, in milliseconds
+             */
             void update() override
             {
-                double deltaTime = _clock.getElapsedTime();
-                _world.get().query<Components...>().forEach(deltaTime, _updateFunc);
+                const double deltaTime = _clock.restart();
+                auto &world = _world.get();
+                auto query = world.template query<Components...>();
+
+                if (_slices == 1 && _budget.count() == 0 && _cursor == 0) {
+                    query.forEach(deltaTime, _updateFunc);
+                    return;
+                }
+                const auto count = world.getCurrentId();
+                const auto end = std::min(count, _cursor + (count + _slices - 1) / _slices);
+                const auto batch = _budget.count() == 0 ? end : budgetBatch;
+                const auto start = std::chrono::steady_clock::now();
+
+                while (_cursor < end) {
+                    const auto last = std::min(end, _cursor + batch);
+
+                    query.forEachRange(_cursor, last, deltaTime, _updateFunc);
+                    _cursor = last;
+                    if (_budget.count() != 0 && std::chrono::steady_clock::now() - start >= _budget) {
+                        break;
+                    }
+                }
+                if (_cursor >= count) {
+                    _cursor = 0;
+                }
             }
 
         private:
-            std::reference_wrapper<Core::World> _world;
+            static constexpr std::size_t budgetBatch = 256;
+
+            std::reference_wrapper<WorldType> _world;
             Func _updateFunc;
             Clock _clock;
+            std::size_t _cursor = 0;
     };
 
+    template<typename Func, typename... Components>
+    using GenericSystem = BasicGenericSystem<World, Func, Components...>;
+
     template<typename... Components, typename Func>
     std::pair<std::string, std::unique_ptr<System>> createSystem(World &aWorld, const std::string &aName,
                                                                  Func aUpdateFunc)
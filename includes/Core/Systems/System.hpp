@@ -1,6 +1,11 @@
 #ifndef SYSTEM_HPP_
 #define SYSTEM_HPP_
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include "Core/Resources.hpp"
+
 namespace Engine::Core {
     class System
     {
@@ -15,7 +20,110 @@ namespace Engine::Core {
             System(const System &) = default;
             System(System &&) = default;
 
+            /**
+             * @brief Get the resources the system declared it reads and writes
+             *
+             * @return const ResourceAccess& The resources
+             */
+            [[nodiscard]] const ResourceAccess &getResourceAccess() const
+            {
+                return _resourceAccess;
+            }
+
+            /**
+             * @brief Check if the system can't run at the same time as another one
+             *
+             * @param aOther The other system
+             * @return true if one writes a resource the other uses
+             */
+            [[nodiscard]] bool conflictsWith(const System &aOther) const
+            {
+                return _resourceAccess.conflictsWith(aOther._resourceAccess);
+            }
+
+            /**
+             * @brief Run the system every few ticks of the World instead of every tick
+             * @details Set it before adding the system: the World staggers the systems sharing an interval so they
+             * don't all run on the same tick
+             *
+             * @param aTicks The number of ticks between two runs, 1 to run every tick
+             */
+            void setInterval(std::size_t aTicks)
+            {
+                _interval = std::max<std::size_t>(aTicks, 1);
+            }
+
+            [[nodiscard]] std::size_t getInterval() const
+            {
+                return _interval;
+            }
+
+            /**
+             * @brief Choose the tick, modulo the interval, the system runs on
+             *
+             * @param aPhase The phase
+             */
+            void setPhase(std::size_t aPhase)
+            {
+                _phase = aPhase;
+            }
+
+            [[nodiscard]] std::size_t getPhase() const
+            {
+                return _phase;
+            }
+
+            /**
+             * @brief Check if the system runs on a tick
+             *
+             * @param aTick The tick of the World
+             * @return true if the tick matches the interval and the phase
+             */
+            [[nodiscard]] bool isDue(std::size_t aTick) const
+            {
+                return aTick % _interval == _phase % _interval;
+            }
+
+            /**
+             * @brief Spread the entities over several runs, each run processing the next 1 / aSlices of the entity
+             * ids in round-robin, so every entity is processed once every aSlices runs
+             * @details Honoured by the query systems (GenericSystem), the other systems may read it
+             *
+             * @param aSlices The number of runs to process all the entities, 1 to process them all each run
+             */
+            void setSlices(std::size_t aSlices)
+            {
+                _slices = std::max<std::size_t>(aSlices, 1);
+            }
+
+            [[nodiscard]] std::size_t getSlices() const
+            {
+                return _slices;
+            }
+
+            /**
+             * @brief Stop a run once it took that long, the next run resumes with the entities left
+             * @details Honoured by the query systems (GenericSystem), checked between batches of entities
+             *
+             * @param aBudget The time budget of a run, 0 for none
+             */
+            void setBudget(std::chrono::nanoseconds aBudget)
+            {
+                _budget = aBudget;
+            }
+
+            [[nodiscard]] std::chrono::nanoseconds getBudget() const
+            {
+                return _budget;
+            }
+
         protected:
+            ResourceAccess _resourceAccess;
+            std::size_t _interval = 1;
+            std::size_t _phase = 0;
+            std::size_t _slices = 1;
+            std::chrono::nanoseconds _budget {0};
+
         private:
     };
 } // namespace Engine::Core
@@ -0,0 +1,392 @@
+#ifndef TAGARRAY_HPP_
+#define TAGARRAY_HPP_
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Exception.hpp"
+#include "MemoryStats.hpp"
+
+namespace Engine::Core {
+
+    DEFINE_EXCEPTION(TagArrayException);
+    DEFINE_EXCEPTION_FROM(TagArrayExceptionOutOfRange, TagArrayException);
+    DEFINE_EXCEPTION_FROM(TagArrayExceptionEmpty, TagArrayException);
+
+    /**
+     * @brief The bits of a TagArray, one per entity, packed 64 per word
+     */
+    class TagBits
+    {
+        public:
+            using word = std::uint64_t;
+            using vectIndex = std::size_t;
+
+            static constexpr vectIndex wordBits = 64;
+
+        protected:
+            std::vector<word> _words;
+            vectIndex _size = 0;
+
+        public:
+#pragma region methods
+            /**
+             * @brief Check if the entity has the tag
+             * @throw TagArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The entity
+             * @return true if the tag is set
+             * @return false if the tag is not set
+             */
+            [[nodiscard]] bool has(vectIndex aIndex) const
+            {
+                checkIndex(aIndex);
+                return test(aIndex);
+            }
+
+            /**
+             * @brief Check if the entity has the tag, without throwing
+             * @param aIndex The entity
+             * @return true if the tag is set
+             * @return false if the tag is not set or the index is out of range
+             */
+            [[nodiscard]] bool contains(vectIndex aIndex) const
+            {
+                return aIndex < _size && test(aIndex);
+            }
+
+            /**
+             * @brief Get the bits, the bit i of the word w is the entity w * 64 + i
+             *
+             * @return std::span<const word> The words
+             */
+            [[nodiscard]] std::span<const word> words() const
+            {
+                return std::span<const word>(_words);
+            }
+
+            /**
+             * @brief Get the word holding the bit of an entity, 0 past the end
+             *
+             * @param aWord The index of the word
+             * @return word The word
+             */
+            [[nodiscard]] word wordAt(vectIndex aWord) const
+            {
+                return aWord < _words.size() ? _words[aWord] : 0;
+            }
+
+            /**
+             * @brief Get the number of entities the array can hold without growing
+             *
+             * @return vectIndex The size
+             */
+            [[nodiscard]] vectIndex size() const
+            {
+                return _size;
+            }
+
+            /**
+             * @brief Get the number of entities with the tag
+             *
+             * @return vectIndex The number of tags set
+             */
+            [[nodiscard]] vectIndex count() const
+            {
+                vectIndex total = 0;
+
+                for (const auto bits : _words) {
+                    total += static_cast<vectIndex>(std::popcount(bits));
+                }
+                return total;
+            }
+#pragma endregion methods
+
+        protected:
+            void checkIndex(vectIndex aIndex) const
+            {
+                if (aIndex >= _size) {
+                    throw TagArrayExceptionOutOfRange("index out of range: " + std::to_string(aIndex));
+                }
+            }
+
+            [[nodiscard]] bool test(vectIndex aIndex) const
+            {
+                return ((_words[aIndex / wordBits] >> (aIndex % wordBits)) & 1U) != 0;
+            }
+
+            void assign(vectIndex aIndex, bool aValue)
+            {
+                const word mask = word {1} << (aIndex % wordBits);
+
+                if (aValue) {
+                    _words[aIndex / wordBits] |= mask;
+                } else {
+                    _words[aIndex / wordBits] &= ~mask;
+                }
+            }
+
+            void resize(vectIndex aSize)
+            {
+                _size = aSize;
+                _words.resize((aSize + wordBits - 1) / wordBits, 0);
+            }
+    };
+
+    /**
+     * @brief TagArray stores ONE empty component type as one bit per entity
+     * @details Selected by ComponentStorage for every empty type. Adding, removing and testing a tag are bit
+     * operations, and queries test the required and excluded tags of 64 entities at once.
+     *
+     * @tparam Tag The type of the tag, must be empty
+     */
+    template<typename Tag>
+    class TagArray final : public TagBits
+    {
+            static_assert(std::is_empty_v<Tag>, "TagArray only stores empty types");
+
+        public:
+            using compRef = Tag &;
+            using constCompRef = const Tag &;
+
+        private:
+            [[no_unique_address]] Tag _tag {};
+            std::uint64_t _presenceVersion = 0;
+
+        public:
+#pragma region constructors / destructors
+            TagArray() = default;
+            ~TagArray() = default;
+
+            TagArray(const TagArray &other) = default;
+            TagArray &operator=(const TagArray &other) = default;
+
+            TagArray(TagArray &&other) noexcept = default;
+            TagArray &operator=(TagArray &&other) noexcept = default;
+#pragma endregion constructors / destructors
+
+#pragma region operators
+            /**
+             * @brief Get the tag of the given entity
+             * @throw TagArrayExceptionOutOfRange if the index is out of range
+             * @throw TagArrayExceptionEmpty if the entity doesn't have the tag
+             * @param aIndex The entity
+             * @return compRef The tag, shared by every entity
+             */
+            compRef operator[](vectIndex aIndex)
+            {
+                return get(aIndex);
+            }
+
+            constCompRef operator[](vectIndex aIndex) const
+            {
+                return get(aIndex);
+            }
+#pragma endregion operators
+
+#pragma region methods
+            /**
+             * @brief Get the tag of the given entity
+             * @throw TagArrayExceptionOutOfRange if the index is out of range
+             * @throw TagArrayExceptionEmpty if the entity doesn't have the tag
+             * @param aIndex The entity
+             * @return compRef The tag, shared by every entity
+             */
+            compRef get(vectIndex aIndex)
+            {
+                checkTag(aIndex);
+                return _tag;
+            }
+
+            constCompRef get(vectIndex aIndex) const
+            {
+                checkTag(aIndex);
+                return _tag;
+            }
+
+            /**
+             * @brief Get the tag of the given entity without throwing
+             * @param aIndex The entity
+             * @return Tag * The tag, nullptr if the index is out of range or the entity doesn't have it
+             */
+            Tag *tryGet(vectIndex aIndex)
+            {
+                return aIndex < _size && test(aIndex) ? &_tag : nullptr;
+            }
+
+            [[nodiscard]] const Tag *tryGet(vectIndex aIndex) const
+            {
+                return aIndex < _size && test(aIndex) ? &_tag : nullptr;
+            }
+
+            /**
+             * @brief Get the tag of the given entity, only checked by an assertion in debug builds
+             * @details For the callers that already know the entity has it, e.g. from its signature
+             * @param aIndex The entity
+             * @return compRef The tag, shared by every entity
+             */
+            compRef getUnchecked([[maybe_unused]] vectIndex aIndex)
+            {
+                assert(aIndex < _size && test(aIndex));
+                return _tag;
+            }
+
+            constCompRef getUnchecked([[maybe_unused]] vectIndex aIndex) const
+            {
+                assert(aIndex < _size && test(aIndex));
+                return _tag;
+            }
+
+            /**
+             * @brief Set the tag of the given entity
+             * @throw TagArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The entity
+             */
+            void set(vectIndex aIndex, Tag && /*aValue*/)
+            {
+                checkIndex(aIndex);
+                assign(aIndex, true);
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Init the entity, will grow the array if needed and remove its tag
+             * @param aIndex The entity
+             */
+            void init(vectIndex aIndex)
+            {
+                if (aIndex >= _size) {
+                    resize(aIndex + 1);
+                }
+                assign(aIndex, false);
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Set the tag of the given entity, will grow the array if needed
+             * @param aIndex The entity
+             * @return compRef The tag, shared by every entity
+             */
+            template<typename... Args>
+            compRef emplace(vectIndex aIndex, Args &&.../*aArgs*/)
+            {
+                if (aIndex >= _size) {
+                    resize(aIndex + 1);
+                }
+                assign(aIndex, true);
+                _presenceVersion++;
+                return _tag;
+            }
+
+            /**
+             * @brief Remove the tag of the given entity
+             * @throw TagArrayExceptionOutOfRange if the index is out of range
+             * @param aIndex The entity
+             */
+            void erase(vectIndex aIndex)
+            {
+                checkIndex(aIndex);
+                assign(aIndex, false);
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Remove every tag
+             */
+            void clear()
+            {
+                _words.clear();
+                _size = 0;
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Move the tag of an entity to another one, the first entity loses it
+             * @details Nothing is moved if the first entity is out of range, the array grows to fit the second one
+             * @param aFrom The entity to move from
+             * @param aTo The entity to move to
+             */
+            void relocate(vectIndex aFrom, vectIndex aTo)
+            {
+                if (aFrom >= _size || aFrom == aTo) {
+                    return;
+                }
+                if (aTo >= _size) {
+                    resize(aTo + 1);
+                }
+                assign(aTo, test(aFrom));
+                assign(aFrom, false);
+                _presenceVersion++;
+            }
+
+            /**
+             * @brief Remove the trailing entities without tag, never below aSize, and release the unused memory
+             * @param aSize The minimum size to keep
+             */
+            void shrinkToFit(vectIndex aSize)
+            {
+                auto newSize = _size;
+
+                while (newSize > aSize && !test(newSize - 1)) {
+                    newSize--;
+                }
+                resize(newSize);
+                _words.shrink_to_fit();
+            }
+
+            /**
+             * @brief Remove all the trailing entities without tag and release the unused memory
+             * @return vectIndex The new size
+             */
+            vectIndex compact()
+            {
+                shrinkToFit(0);
+                return _size;
+            }
+
+            /**
+             * @brief Get the memory used by the array, a tag has no live bytes
+             * @return MemoryStats The memory used
+             */
+            [[nodiscard]] MemoryStats memoryStats() const
+            {
+                return MemoryStats {_words.capacity() * sizeof(word), 0, _size, count()};
+            }
+
+            /**
+             * @brief Get the version of the set of filled slots, changed by each call adding or removing a component
+             * @details Lets the World notice the components added or removed through the storage instead of its own
+             * API
+             * @return std::uint64_t The version
+             */
+            [[nodiscard]] std::uint64_t presenceVersion() const
+            {
+                return _presenceVersion;
+            }
+#pragma endregion methods
+
+        private:
+            void checkTag(vectIndex aIndex) const
+            {
+                checkIndex(aIndex);
+                if (!test(aIndex)) {
+                    throw TagArrayExceptionEmpty("index is empty: " + std::to_string(aIndex));
+                }
+            }
+    };
+
+    template<typename Storage>
+    struct IsTagArray : std::false_type
+    {};
+
+    template<typename Tag>
+    struct IsTagArray<TagArray<Tag>> : std::true_type
+    {};
+} // namespace Engine::Core
+
+#endif /* !TAGARRAY_HPP_ */
@@ -0,0 +1,153 @@
+#ifndef TIMERWHEEL_HPP_
+#define TIMERWHEEL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Engine::Core {
+
+    class World;
+
+    /**
+     * @brief Timers counted in World ticks, stored in a hierarchical timing wheel
+     * @details Four wheels of 256 slots cover 2^32 ticks, the later timers wait in an overflow list. A timer sits in
+     * the wheel of the highest byte its due tick differs from the current tick on, and moves down one wheel each time
+     * the lower wheel wraps. Adding and cancelling are O(1), advancing a tick only touches the due timers and the
+     * ones moving down, whatever the number of pending timers.
+     * The timers of an entity are cancelled together when the entity is killed.
+     */
+    class TimerWheel
+    {
+        public:
+            using timerId = std::uint64_t;
+            using tick = std::uint64_t;
+            using timerFunc = std::function<void(World &)>;
+
+            static constexpr std::size_t noOwner = std::numeric_limits<std::size_t>::max();
+            static constexpr timerId invalidTimer = std::numeric_limits<timerId>::max();
+
+        private:
+            static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+            static constexpr std::size_t slotBits = 8;
+            static constexpr std::size_t slotCount = std::size_t {1} << slotBits;
+            static constexpr std::size_t wheelCount = 4;
+            static constexpr std::size_t overflowList = wheelCount * slotCount;
+            static constexpr std::size_t firingList = overflowList + 1;
+            static constexpr std::size_t listCount = firingList + 1;
+
+            struct Node
+            {
+                    tick due = 0;
+                    timerFunc func;
+                    std::size_t owner = noOwner;
+                    std::uint32_t generation = 0;
+                    std::uint32_t list = npos;
+                    std::uint32_t prev = npos;
+                    std::uint32_t next = npos;
+                    std::uint32_t ownerPrev = npos;
+                    std::uint32_t ownerNext = npos;
+            };
+
+            std::vector<Node> _nodes;
+            std::vector<std::uint32_t> _free;
+            std::vector<std::uint32_t> _heads = std::vector<std::uint32_t>(listCount, npos);
+            std::vector<std::uint32_t> _owners;
+            tick _now = 0;
+            std::size_t _size = 0;
+
+        public:
+#pragma region constructors / destructors
+            TimerWheel() = default;
+            ~TimerWheel() = default;
+
+            TimerWheel(const TimerWheel &other) = default;
+            TimerWheel &operator=(const TimerWheel &other) = default;
+
+            TimerWheel(TimerWheel &&other) noexcept = default;
+            TimerWheel &operator=(TimerWheel &&other) noexcept = default;
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            /**
+             * @brief Add a timer
+             *
+             * @param aDelay The number of ticks before it fires, at least 1
+             * @param aFunc Called when the timer fires
+             * @param aOwner The entity the timer is cancelled with, noOwner for none
+             * @return timerId The timer, to cancel it
+             */
+            timerId add(tick aDelay, timerFunc aFunc, std::size_t aOwner = noOwner);
+
+            /**
+             * @brief Cancel a timer, nothing happens if it already fired or was cancelled
+             *
+             * @param aTimer The timer
+             * @return true if the timer was pending
+             * @return false otherwise
+             */
+            bool cancel(timerId aTimer);
+
+            /**
+             * @brief Cancel all the timers of an entity
+             *
+             * @param aOwner The entity
+             * @return std::size_t The number of timers cancelled
+             */
+            std::size_t cancelOwner(std::size_t aOwner);
+
+            /**
+             * @brief Move the timers of the entities to their new ids, e.g. after a defragmentation
+             * @details The timers of the entities without a new id are cancelled
+             *
+             * @param aRemap The new id of each old id, noOwner for the dead ones
+             */
+            void remapOwners(std::span<const std::size_t> aRemap);
+
+            /**
+             * @brief Check if a timer is still pending
+             *
+             * @param aTimer The timer
+             * @return true if it will fire
+             * @return false if it fired or was cancelled
+             */
+            [[nodiscard]] bool isPending(timerId aTimer) const;
+
+            /**
+             * @brief Move the time forward, firing the due timers in the order of their due tick
+             * @details A timer added by a callback for the current tick fires on the next one
+             *
+             * @param aWorld The World given to the callbacks
+             * @param aTicks The number of ticks
+             * @return std::size_t The number of timers fired
+             */
+            std::size_t advance(World &aWorld, tick aTicks = 1);
+
+            /**
+             * @brief Get the current tick
+             *
+             * @return tick The number of ticks advanced since the creation
+             */
+            [[nodiscard]] tick now() const;
+
+            /**
+             * @brief Get the number of pending timers
+             *
+             * @return std::size_t The number of timers
+             */
+            [[nodiscard]] std::size_t size() const;
+#pragma endregion methods
+
+        private:
+            void place(std::uint32_t aNode);
+            void link(std::uint32_t aNode, std::size_t aList);
+            void unlink(std::uint32_t aNode);
+            void release(std::uint32_t aNode);
+            void cascade(std::size_t aList);
+    };
+} // namespace Engine::Core
+
+#endif /* !TIMERWHEEL_HPP_ */
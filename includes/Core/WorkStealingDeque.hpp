@@ -0,0 +1,187 @@
+#ifndef WORKSTEALINGDEQUE_HPP_
+#define WORKSTEALINGDEQUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace Engine::Core {
+
+    /**
+     * @brief Chase-Lev deque: its owner pushes and pops at the bottom, any thread steals at the top
+     * @details Only the owner thread may call push and pop. The ring doubles when full, the old rings are kept
+     * until the deque is destroyed since a thief may still read them.
+     *
+     * @tparam Type The type of the items, must be trivially copyable
+     */
+    template<typename Type>
+    class WorkStealingDeque final
+    {
+        public:
+            static constexpr std::size_t defaultCapacity = 256;
+
+        private:
+            class Ring
+            {
+                public:
+                    explicit Ring(std::int64_t aCapacity)
+                        : _mask(aCapacity - 1),
+                          _items(std::make_unique<std::atomic<Type>[]>(static_cast<std::size_t>(aCapacity)))
+                    {}
+
+                    [[nodiscard]] std::int64_t capacity() const
+                    {
+                        return _mask + 1;
+                    }
+
+                    [[nodiscard]] Type get(std::int64_t aIndex) const
+                    {
+                        return _items[static_cast<std::size_t>(aIndex & _mask)].load(std::memory_order_relaxed);
+                    }
+
+                    void put(std::int64_t aIndex, Type aItem)
+                    {
+                        _items[static_cast<std::size_t>(aIndex & _mask)].store(aItem, std::memory_order_relaxed);
+                    }
+
+                private:
+                    std::int64_t _mask;
+                    std::unique_ptr<std::atomic<Type>[]> _items;
+            };
+
+            std::atomic<std::int64_t> _top {0};
+            std::atomic<std::int64_t> _bottom {0};
+            std::atomic<Ring *> _ring;
+            std::vector<std::unique_ptr<Ring>> _rings;
+
+        public:
+#pragma region constructors / destructors
+            /**
+             * @brief Create an empty deque
+             *
+             * @param aCapacity The initial capacity, rounded up to a power of two
+             */
+            explicit WorkStealingDeque(std::size_t aCapacity = defaultCapacity)
+            {
+                std::int64_t capacity = 1;
+
+                while (capacity < static_cast<std::int64_t>(aCapacity)) {
+                    capacity *= 2;
+                }
+                _rings.push_back(std::make_unique<Ring>(capacity));
+                _ring.store(_rings.back().get(), std::memory_order_relaxed);
+            }
+
+            ~WorkStealingDeque() = default;
+
+            WorkStealingDeque(const WorkStealingDeque &other) = delete;
+            WorkStealingDeque &operator=(const WorkStealingDeque &other) = delete;
+
+            WorkStealingDeque(WorkStealingDeque &&other) noexcept = delete;
+            WorkStealingDeque &operator=(WorkStealingDeque &&other) noexcept = delete;
+#pragma endregion constructors / destructors
+
+#pragma region methods
+            /**
+             * @brief Push an item at the bottom, owner only
+             *
+             * @param aItem The item
+             */
+            void push(Type aItem)
+            {
+                const auto bottom = _bottom.load(std::memory_order_relaxed);
+                const auto top = _top.load(std::memory_order_acquire);
+                auto *ring = _ring.load(std::memory_order_relaxed);
+
+                if (bottom - top > ring->capacity() - 1) {
+                    ring = grow(ring, top, bottom);
+                }
+                ring->put(bottom, aItem);
+                _bottom.store(bottom + 1, std::memory_order_release);
+            }
+
+            /**
+             * @brief Pop the last pushed item, owner only
+             *
+             * @return std::optional<Type> The item, empty if the deque is empty or a thief took the last one
+             */
+            std::optional<Type> pop()
+            {
+                const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+                auto *ring = _ring.load(std::memory_order_relaxed);
+
+                _bottom.store(bottom, std::memory_order_seq_cst);
+                auto top = _top.load(std::memory_order_seq_cst);
+
+                if (top > bottom) {
+                    _bottom.store(bottom + 1, std::memory_order_relaxed);
+                    return std::nullopt;
+                }
+                auto item = ring->get(bottom);
+
+                if (top == bottom) {
+                    const bool won =
+                        _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+
+                    _bottom.store(bottom + 1, std::memory_order_relaxed);
+                    if (!won) {
+                        return std::nullopt;
+                    }
+                }
+                return item;
+            }
+
+            /**
+             * @brief Take the oldest item, any thread
+             *
+             * @return std::optional<Type> The item, empty if the deque is empty or another thread took it
+             */
+            std::optional<Type> steal()
+            {
+                auto top = _top.load(std::memory_order_seq_cst);
+                const auto bottom = _bottom.load(std::memory_order_seq_cst);
+
+                if (top >= bottom) {
+                    return std::nullopt;
+                }
+                auto item = _ring.load(std::memory_order_acquire)->get(top);
+
+                if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    return std::nullopt;
+                }
+                return item;
+            }
+
+            /**
+             * @brief Get an estimation of the number of items
+             *
+             * @return std::size_t The number of items when it was read
+             */
+            [[nodiscard]] std::size_t size() const
+            {
+                const auto bottom = _bottom.load(std::memory_order_relaxed);
+                const auto top = _top.load(std::memory_order_relaxed);
+
+                return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+            }
+#pragma endregion methods
+
+        private:
+            Ring *grow(Ring *aRing, std::int64_t aTop, std::int64_t aBottom)
+            {
+                auto bigger = std::make_unique<Ring>(aRing->capacity() * 2);
+
+                for (auto idx = aTop; idx < aBottom; idx++) {
+                    bigger->put(idx, aRing->get(idx));
+                }
+                _rings.push_back(std::move(bigger));
+                _ring.store(_rings.back().get(), std::memory_order_release);
+                return _rings.back().get();
+            }
+    };
+} // namespace Engine::Core
+
+#endif /* !WORKSTEALINGDEQUE_HPP_ */
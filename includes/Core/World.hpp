@@ -1,17 +1,38 @@
 #ifndef WORLD_HPP_
 #define WORLD_HPP_
 
+#include <algorithm>
 #include <any>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <bitset>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <span>
 #include <tuple>
+#include <type_traits>
 #include <typeindex>
 #include <utility>
 #include <vector>
+#include "Events/EventsManager.hpp"
 #include "Exception.hpp"
-#include "SparseArray.hpp"
+#include "Expected.hpp"
+#include "JobSystem.hpp"
+#include "ComponentStorage.hpp"
+#include "MemoryStats.hpp"
+#include "Clock.hpp"
+#include "EntityIndex.hpp"
+#include "Profiler.hpp"
+#include "QueryFilters.hpp"
+#include "Resources.hpp"
+#include "Script.hpp"
+#include "StateHash.hpp"
 #include "Systems/System.hpp"
+#include "TimerWheel.hpp"
 #include <boost/container/flat_map.hpp>
 namespace Engine::Core {
     DEFINE_EXCEPTION(WorldException);
@@ -19,6 +40,23 @@ namespace Engine::Core {
     DEFINE_EXCEPTION_FROM(WorldExceptionComponentNotRegistered, WorldException);
     DEFINE_EXCEPTION_FROM(WorldExceptionSystemAlreadyRegistered, WorldException);
     DEFINE_EXCEPTION_FROM(WorldExceptionSystemNotRegistered, WorldException);
+    DEFINE_EXCEPTION_FROM(WorldExceptionTooManyComponents, WorldException);
+    DEFINE_EXCEPTION_FROM(WorldExceptionComponentAlreadyGrouped, WorldException);
+    DEFINE_EXCEPTION_FROM(WorldExceptionGroupNotRegistered, WorldException);
+    DEFINE_EXCEPTION_FROM(WorldExceptionQueryNotRegistered, WorldException);
+    DEFINE_EXCEPTION_FROM(WorldExceptionStateHashNotTracked, WorldException);
+    DEFINE_EXCEPTION_FROM(WorldExceptionResourceNotFound, WorldException);
+    DEFINE_EXCEPTION_FROM(WorldExceptionComponentsFrozen, WorldException);
+
+    /**
+     * @brief Why an operation of the non-throwing World API failed
+     */
+    enum class WorldError
+    {
+        ComponentNotRegistered, ///< The component wasn't registered
+        EntityOutOfRange,       ///< The entity was never created
+        ComponentMissing,       ///< The entity doesn't have the component
+    };
 
     /**
      * @brief The world class represents a level, a scene
@@ -28,288 +66,1878 @@ namespace Engine::Core {
     class World
     {
         public:
+            static constexpr std::size_t maxComponents = 64;
+            static constexpr std::size_t nullId = std::numeric_limits<std::size_t>::max();
+            static constexpr std::size_t defaultParallelGrain = 1024;
+
             using id = std::size_t;
+            using signature = std::bitset<maxComponents>;
+            using signatures = std::vector<signature>;
             using containerFunc = std::function<void(World &, const id &)>;
-            using container = std::pair<std::any, std::tuple<containerFunc, containerFunc>>;
+            using statsFunc = std::function<MemoryStats(const World &)>;
+            using relocateFunc = std::function<void(World &, const id &, const id &)>;
+            using swapFunc = std::function<std::size_t(World &)>;
+            using syncFunc = std::function<void(World &)>;
+            using container = std::pair<std::any, std::tuple<containerFunc, containerFunc, std::size_t, containerFunc,
+                                                             statsFunc, relocateFunc, syncFunc>>;
             using containerMap = boost::container::flat_map<std::type_index, container>;
             using idsContainer = std::vector<id>;
+            using idRemap = std::vector<id>;
             using systemFunc = std::unique_ptr<System>;
             using newSystemFunc = std::pair<std::string, std::unique_ptr<System>>;
             using systems = boost::container::flat_map<std::string, systemFunc>;
 
-        protected:
-            containerMap _components;
-            idsContainer _ids;
-            std::size_t _nextId = 0;
-            systems _systems;
+        protected:
+            /**
+             * @brief Destroy a type erased resource, and copy it when the World is forked
+             */
+            struct ResourceDeleter
+            {
+                    void (*destroy)(void *) = nullptr;
+                    void *(*clone)(const void *) = nullptr;
+
+                    void operator()(void *aResource) const
+                    {
+                        destroy(aResource);
+                    }
+            };
+
+            using resourcePtr = std::unique_ptr<void, ResourceDeleter>;
+
+            struct GroupData;
+
+            using groupFunc = std::function<void(World &, GroupData &, id)>;
+
+            /**
+             * @brief State of an owning group: the owned components of its members are packed at the front of each
+             * owned PackedArray, in the same entity order
+             * @details A group whose component is removed is dropped but keeps its slot, so the index held by the Group
+             * handles stays valid
+             */
+            struct GroupData
+            {
+                    signature owned;
+                    std::size_t size = 0;
+                    groupFunc enter;
+                    groupFunc leave;
+
+                    void drop()
+                    {
+                        owned.reset();
+                        size = 0;
+                        enter = [](World & /*aWorld*/, GroupData & /*aGroup*/, id /*aIdx*/) {};
+                        leave = enter;
+                    }
+            };
+
+            /**
+             * @brief State of a cached query: the entities matching its terms, packed, and the position of each entity
+             * in the packed list
+             * @details A cache whose component is removed is dropped but keeps its slot, so the index held by the
+             * CachedQuery handles stays valid
+             */
+            struct QueryCacheData
+            {
+                    signature required;
+                    signature excluded;
+                    std::vector<id> entities;
+                    std::vector<std::size_t> positions;
+                    bool dropped = false;
+
+                    [[nodiscard]] bool matches(const signature &aSignature) const
+                    {
+                        return !dropped && (aSignature & required) == required && (aSignature & excluded).none();
+                    }
+
+                    [[nodiscard]] bool isOf(const signature &aRequired, const signature &aExcluded) const
+                    {
+                        return !dropped && required == aRequired && excluded == aExcluded;
+                    }
+
+                    void drop()
+                    {
+                        dropped = true;
+                        entities = {};
+                        positions = {};
+                    }
+
+                    void insert(id aIdx)
+                    {
+                        if (aIdx >= positions.size()) {
+                            positions.resize(aIdx + 1, nullId);
+                        }
+                        if (positions[aIdx] != nullId) {
+                            return;
+                        }
+                        positions[aIdx] = entities.size();
+                        entities.push_back(aIdx);
+                    }
+
+                    void erase(id aIdx)
+                    {
+                        if (aIdx >= positions.size() || positions[aIdx] == nullId) {
+                            return;
+                        }
+                        const auto position = positions[aIdx];
+
+                        entities[position] = entities.back();
+                        positions[entities[position]] = position;
+                        entities.pop_back();
+                        positions[aIdx] = nullId;
+                    }
+            };
+
+            containerMap _components;
+            idsContainer _ids;
+            std::size_t _nextId = 0;
+            systems _systems;
+            signatures _signatures;
+            signature _usedBits;
+            std::vector<GroupData> _groups;
+            std::vector<QueryCacheData> _queryCaches;
+            Profiler _profiler;
+            std::vector<Profiler::nameId> _systemNames;
+            std::size_t _processedEntities = 0;
+            std::unique_ptr<ScriptScheduler> _scheduler {std::make_unique<ScriptScheduler>()};
+            Clock _scriptClock;
+            std::vector<resourcePtr> _resources;
+            std::vector<StateHash> _stateHashes;
+            TimerWheel _timers;
+            std::size_t _tick = 0;
+            EntityIndex _entityIndex;
+            boost::container::flat_map<std::size_t, swapFunc> _bufferSwaps;
+            std::array<std::uint64_t, maxComponents> _presenceVersions {};
+            std::vector<std::uint8_t> _alive;
+            bool _frozen = false;
+
+            /**
+             * @brief Give to the query callback what a term asks for
+             * @details Built once per forEach so the storages are only looked up once
+             *
+             * @tparam Term A component, passed by reference
+             */
+            template<typename Term>
+            class TermFetcher
+            {
+                    static_assert(!IsSoAArray<StorageOf<Term>>::value,
+                                  "SoA components are stored field by field and can't be passed by reference, use "
+                                  "With<...> in the query and getComponent<T>().field<N>() or forEachBatch");
+
+                public:
+                    explicit TermFetcher(World &aWorld)
+                        : _storage(aWorld.getComponent<Term>()),
+                          _hash(aWorld.writtenStateHash(aWorld.getComponentBit<Term>()))
+                    {}
+
+                    std::tuple<Term &> fetch(const signature & /*aSignature*/, std::size_t aIndex)
+                    {
+                        if (_hash != nullptr) {
+                            _hash->markWritten(aIndex);
+                        }
+                        return std::tuple<Term &>(_storage.get().getUnchecked(aIndex));
+                    }
+
+                private:
+                    std::reference_wrapper<StorageOf<Term>> _storage;
+                    StateHash *_hash;
+            };
+
+            template<typename Term>
+            class TermFetcher<const Term>
+            {
+                    static_assert(!IsSoAArray<StorageOf<Term>>::value,
+                                  "SoA components are stored field by field and can't be passed by reference, use "
+                                  "With<...> in the query and getComponent<T>().field<N>() or forEachBatch");
+
+                public:
+                    explicit TermFetcher(World &aWorld)
+                        : _storage(std::as_const(aWorld).getComponent<Term>())
+                    {}
+
+                    std::tuple<const Term &> fetch(const signature & /*aSignature*/, std::size_t aIndex)
+                    {
+                        return std::tuple<const Term &>(_storage.get().getUnchecked(aIndex));
+                    }
+
+                private:
+                    std::reference_wrapper<const StorageOf<Term>> _storage;
+            };
+
+            template<typename... Components>
+            class TermFetcher<With<Components...>>
+            {
+                public:
+                    explicit TermFetcher(World & /*aWorld*/)
+                    {}
+
+                    std::tuple<> fetch(const signature & /*aSignature*/, std::size_t /*aIndex*/)
+                    {
+                        return {};
+                    }
+            };
+
+            template<typename... Components>
+            class TermFetcher<Without<Components...>>
+            {
+                public:
+                    explicit TermFetcher(World & /*aWorld*/)
+                    {}
+
+                    std::tuple<> fetch(const signature & /*aSignature*/, std::size_t /*aIndex*/)
+                    {
+                        return {};
+                    }
+            };
+
+            template<typename Resource>
+            class TermFetcher<Read<Resource>>
+            {
+                public:
+                    explicit TermFetcher(World &aWorld)
+                        : _resource(aWorld.getResource<Resource>())
+                    {}
+
+                    std::tuple<const Resource &> fetch(const signature & /*aSignature*/, std::size_t /*aIndex*/)
+                    {
+                        return std::tuple<const Resource &>(_resource.get());
+                    }
+
+                private:
+                    std::reference_wrapper<const Resource> _resource;
+            };
+
+            template<typename Resource>
+            class TermFetcher<Write<Resource>>
+            {
+                public:
+                    explicit TermFetcher(World &aWorld)
+                        : _resource(aWorld.getResource<Resource>())
+                    {}
+
+                    std::tuple<Resource &> fetch(const signature & /*aSignature*/, std::size_t /*aIndex*/)
+                    {
+                        return std::tuple<Resource &>(_resource.get());
+                    }
+
+                private:
+                    std::reference_wrapper<Resource> _resource;
+            };
+
+            template<typename... Components>
+            class TermFetcher<Optional<Components...>>
+            {
+                    static_assert((!IsSoAArray<StorageOf<Components>>::value && ...),
+                                  "SoA components are stored field by field and can't be passed by pointer, use "
+                                  "getComponent<T>().field<N>() or forEachBatch");
+
+                public:
+                    explicit TermFetcher(World &aWorld)
+                        : _storages(&aWorld.getComponent<Components>()...),
+                          _bits {aWorld.getComponentBit<Components>()...},
+                          _hashes {aWorld.writtenStateHash(aWorld.getComponentBit<Components>())...}
+                    {}
+
+                    std::tuple<Components *...> fetch(const signature &aSignature, std::size_t aIndex)
+                    {
+                        return fetch(aSignature, aIndex, std::index_sequence_for<Components...> {});
+                    }
+
+                private:
+                    std::tuple<StorageOf<Components> *...> _storages;
+                    std::array<std::size_t, sizeof...(Components)> _bits;
+                    std::array<StateHash *, sizeof...(Components)> _hashes;
+
+                    template<std::size_t... Idx>
+                    std::tuple<Components *...> fetch(const signature &aSignature, std::size_t aIndex,
+                                                     std::index_sequence<Idx...> /*unused*/)
+                    {
+                        for (std::size_t idx = 0; idx < sizeof...(Components); idx++) {
+                            if (_hashes[idx] != nullptr && aSignature.test(_bits[idx])) {
+                                _hashes[idx]->markWritten(aIndex);
+                            }
+                        }
+                        return std::tuple<Components *...>(
+                            (aSignature.test(_bits[Idx]) ? &std::get<Idx>(_storages)->getUnchecked(aIndex) : nullptr)...);
+                    }
+            };
+
+            template<typename... Components>
+            class TermFetcher<Previous<Components...>>
+            {
+                    static_assert((isDoubleBuffered<StorageOf<Components>> && ...),
+                                  "Previous<...> terms must be stored in a DoubleBufferedArray");
+
+                public:
+                    explicit TermFetcher(World &aWorld)
+                        : _storages(&std::as_const(aWorld.getComponent<Components>())...)
+                    {}
+
+                    std::tuple<const Components &...> fetch(const signature & /*aSignature*/, std::size_t aIndex)
+                    {
+                        return std::tuple<const Components &...>(
+                            std::get<const StorageOf<Components> *>(_storages)->getPreviousUnchecked(aIndex)...);
+                    }
+
+                private:
+                    std::tuple<const StorageOf<Components> *...> _storages;
+            };
+
+            /**
+             * @brief Iterate over the entities matching a list of terms
+             * @details Terms are components (passed by reference), With<...> (required, not passed), Without<...>
+             * (rejected), Optional<...> (passed as pointers) and Previous<...> (passed by const reference, as they were
+             * at the last tick boundary). SoA components can only be With<...> or Without<...> terms. Matching is a
+             * single test of the entity signature, tag terms stored as a TagArray first filter the entities 64 at a time.
+             *
+             * @tparam Terms The terms of the query
+             */
+            template<typename... Terms>
+            class Query
+            {
+                public:
+                    explicit Query(Core::World &world)
+                        : _world(world),
+                          _required(world.signatureOf(QueryRequired<Terms...> {})),
+                          _excluded(world.signatureOf(QueryExcluded<Terms...> {})),
+                          _requiredTags(world.tagBitsOf(QueryRequired<Terms...> {})),
+                          _excludedTags(world.tagBitsOf(QueryExcluded<Terms...> {}))
+                    {}
+
+                    void forEach(double deltaTime, QueryFunc<Terms...> func)
+                    {
+                        auto &world = _world.get();
+
+                        world.syncPresence();
+                        [[maybe_unused]] const auto processed = forEachIn(0, world.getCurrentId(), deltaTime, func);
+
+#ifdef ENGINE_PROFILING
+                        world._processedEntities += processed;
+#endif
+                    }
+
+                    /**
+                     * @brief Split the entities into jobs run by a job system, the callback must be safe to call from
+                     * several threads at once
+                     *
+                     * @param deltaTime The time given to the callback
+                     * @param func The callback
+                     * @param grain The number of entity ids per job
+                     * @param jobs The job system, the engine one by default
+                     */
+                    void forEachParallel(double deltaTime, QueryFunc<Terms...> func,
+                                         std::size_t grain = defaultParallelGrain,
+                                         JobSystem &jobs = JobSystem::getInstance())
+                    {
+                        std::atomic<std::size_t> processed {0};
+
+                        _world.get().syncPresence();
+                        // the jobs must not copy the storages still shared with a fork
+                        [[maybe_unused]] const std::tuple<TermFetcher<Terms>...> unshared {
+                            TermFetcher<Terms>(_world.get())...};
+
+                        jobs.parallelFor(_world.get().getCurrentId(), grain,
+                                         [this, deltaTime, &func, &processed](std::size_t aBegin, std::size_t aEnd) {
+                                             processed += forEachIn(aBegin, aEnd, deltaTime, func);
+                                         });
+#ifdef ENGINE_PROFILING
+                        _world.get()._processedEntities += processed.load();
+#endif
+                    }
+
+                    /**
+                     * @brief Iterate over the matched entities whose id is in a range, e.g. a slice of the entities
+                     *
+                     * @param aBegin The first id
+                     * @param aEnd The id past the last one, clamped to the current id
+                     * @param deltaTime The time given to the callback
+                     * @param func The callback
+                     * @return std::size_t The number of entities processed
+                     */
+                    std::size_t forEachRange(std::size_t aBegin, std::size_t aEnd, double deltaTime,
+                                             QueryFunc<Terms...> func)
+                    {
+                        auto &world = _world.get();
+
+                        world.syncPresence();
+                        const auto processed =
+                            forEachIn(aBegin, std::min(aEnd, world.getCurrentId()), deltaTime, func);
+
+#ifdef ENGINE_PROFILING
+                        world._processedEntities += processed;
+#endif
+                        return processed;
+                    }
+
+                private:
+                    std::size_t forEachIn(std::size_t aBegin, std::size_t aEnd, double deltaTime,
+                                          QueryFunc<Terms...> &func)
+                    {
+                        auto &world = _world.get();
+                        std::tuple<TermFetcher<Terms>...> fetchers {TermFetcher<Terms>(world)...};
+                        std::size_t processed = 0;
+                        auto visit = [&](std::size_t idx) {
+                            const auto &entitySignature = world._signatures[idx];
+
+                            if ((entitySignature & _required) != _required || (entitySignature & _excluded).any()
+                                || (_required.none() && !world.isAlive(idx))) {
+                                return;
+                            }
+                            processed++;
+                            std::apply(func, std::apply(
+                                                 [&](auto &...aFetcher) {
+                                                     return std::tuple_cat(
+                                                         std::forward_as_tuple(world, deltaTime, idx),
+                                                         aFetcher.fetch(entitySignature, idx)...);
+                                                 },
+                                                 fetchers));
+                        };
+
+                        if (_requiredTags.empty() && _excludedTags.empty()) {
+                            for (std::size_t idx = aBegin; idx < aEnd; idx++) {
+                                visit(idx);
+                            }
+                            return processed;
+                        }
+                        for (auto word = aBegin / TagBits::wordBits; word * TagBits::wordBits < aEnd; word++) {
+                            auto candidates = ~TagBits::word {0};
+
+                            for (const auto *tags : _requiredTags) {
+                                candidates &= tags->wordAt(word);
+                            }
+                            for (const auto *tags : _excludedTags) {
+                                candidates &= ~tags->wordAt(word);
+                            }
+                            while (candidates != 0) {
+                                const auto idx = word * TagBits::wordBits
+                                                 + static_cast<std::size_t>(std::countr_zero(candidates));
+
+                                candidates &= candidates - 1;
+                                if (idx >= aBegin && idx < aEnd) {
+                                    visit(idx);
+                                }
+                            }
+                        }
+                        return processed;
+                    }
+
+                    std::reference_wrapper<Core::World> _world;
+                    signature _required;
+                    signature _excluded;
+                    std::vector<const TagBits *> _requiredTags;
+                    std::vector<const TagBits *> _excludedTags;
+            };
+
+            /**
+             * @brief Iterate over the members of an owning group
+             * @details The owned arrays are walked in lockstep from their first element, without any lookup
+             *
+             * @tparam Owned The components owned by the group
+             */
+            template<typename... Owned>
+            class Group
+            {
+                public:
+                    Group(Core::World &world, std::size_t groupIdx)
+                        : _world(world),
+                          _groupIdx(groupIdx)
+                    {}
+
+                    [[nodiscard]] std::size_t size() const
+                    {
+                        return _world.get()._groups[_groupIdx].size;
+                    }
+
+                    void forEach(double deltaTime,
+                                 std::function<void(World &world, double deltaTime, std::size_t idx, Owned &...)> func)
+                    {
+                        auto &world = _world.get();
+
+                        world.syncPresence();
+                        const auto count = size();
+
+                        if (world._groups[_groupIdx].owned.none()) {
+                            return;
+                        }
+                        const auto entities = world.getComponent<FirstOwned>().entities();
+                        auto components = std::make_tuple(world.getComponent<Owned>().data().data()...);
+
+                        for (auto *hash : {world.writtenStateHash(world.getComponentBit<Owned>())...}) {
+                            for (std::size_t idx = 0; hash != nullptr && idx < count; idx++) {
+                                hash->markWritten(entities[idx]);
+                            }
+                        }
+                        for (std::size_t idx = 0; idx < count; idx++) {
+                            func(world, deltaTime, entities[idx], std::get<Owned *>(components)[idx]...);
+                        }
+#ifdef ENGINE_PROFILING
+                        world._processedEntities += count;
+#endif
+                    }
+
+                private:
+                    using FirstOwned = std::tuple_element_t<0, std::tuple<Owned...>>;
+
+                    std::reference_wrapper<Core::World> _world;
+                    std::size_t _groupIdx;
+            };
+
+            /**
+             * @brief Iterate over the entities of a query registered with registerQuery
+             * @details The matching entities are kept in a packed list, updated when the components of an entity
+             * change, so iterating is a walk of the list without any signature test. The order of the entities isn't
+             * kept. Adding or removing the components of the terms from the callback may skip or repeat entities.
+             * Once a component of its terms is removed from the World, the query matches nothing
+             *
+             * @tparam Terms The terms of the query
+             */
+            template<typename... Terms>
+            class CachedQuery
+            {
+                public:
+                    CachedQuery(Core::World &world, std::size_t cacheIdx)
+                        : _world(world),
+                          _cacheIdx(cacheIdx)
+                    {}
+
+                    [[nodiscard]] std::size_t size() const
+                    {
+                        return _world.get()._queryCaches[_cacheIdx].entities.size();
+                    }
+
+                    /**
+                     * @brief Get the entities matching the query
+                     *
+                     * @return std::span<const id> The entities, in no particular order
+                     */
+                    [[nodiscard]] std::span<const id> entities() const
+                    {
+                        _world.get().syncPresence();
+                        return std::span<const id>(_world.get()._queryCaches[_cacheIdx].entities);
+                    }
+
+                    void forEach(double deltaTime, QueryFunc<Terms...> func)
+                    {
+                        _world.get().syncPresence();
+                        [[maybe_unused]] const auto processed = forEachIn(0, size(), deltaTime, func);
+
+#ifdef ENGINE_PROFILING
+                        _world.get()._processedEntities += processed;
+#endif
+                    }
+
+                    /**
+                     * @brief Split the matching entities into jobs run by a job system, the callback must be safe to
+                     * call from several threads at once and must not add or remove components
+                     *
+                     * @param deltaTime The time given to the callback
+                     * @param func The callback
+                     * @param grain The number of entities per job
+                     * @param jobs The job system, the engine one by default
+                     */
+                    void forEachParallel(double deltaTime, QueryFunc<Terms...> func,
+                                         std::size_t grain = defaultParallelGrain,
+                                         JobSystem &jobs = JobSystem::getInstance())
+                    {
+                        std::atomic<std::size_t> processed {0};
+
+                        _world.get().syncPresence();
+                        // the jobs must not copy the storages still shared with a fork
+                        [[maybe_unused]] const std::tuple<TermFetcher<Terms>...> unshared {
+                            TermFetcher<Terms>(_world.get())...};
+
+                        jobs.parallelFor(size(), grain,
+                                         [this, deltaTime, &func, &processed](std::size_t aBegin, std::size_t aEnd) {
+                                             processed += forEachIn(aBegin, aEnd, deltaTime, func);
+                                         });
+#ifdef ENGINE_PROFILING
+                        _world.get()._processedEntities += processed.load();
+#endif
+                    }
+
+                private:
+                    std::size_t forEachIn(std::size_t aBegin, std::size_t aEnd, double deltaTime,
+                                          QueryFunc<Terms...> &func)
+                    {
+                        auto &world = _world.get();
+                        std::tuple<TermFetcher<Terms>...> fetchers {TermFetcher<Terms>(world)...};
+                        std::size_t processed = 0;
+
+                        for (auto position = aBegin; position < aEnd && position < size(); position++) {
+                            const auto idx = world._queryCaches[_cacheIdx].entities[position];
+                            const auto &entitySignature = world._signatures[idx];
+
+                            processed++;
+                            std::apply(func, std::apply(
+                                                 [&](auto &...aFetcher) {
+                                                     return std::tuple_cat(
+                                                         std::forward_as_tuple(world, deltaTime, idx),
+                                                         aFetcher.fetch(entitySignature, idx)...);
+                                                 },
+                                                 fetchers));
+                        }
+                        return processed;
+                    }
+
+                    std::reference_wrapper<Core::World> _world;
+                    std::size_t _cacheIdx;
+            };
+
+        public:
+#pragma region constructors / destructors
+            World() = default;
+            virtual ~World() = default;
+
+            World(const World &other) = default;
+            World &operator=(const World &other) = default;
+
+            World(World &&other) noexcept = default;
+            World &operator=(World &&other) noexcept = default;
+#pragma endregion constructors / destructors
+
+#pragma region methods
+
+            /**
+             * @brief Build a query over the entities matching the terms
+             *
+             * @tparam Terms Components, const components (read only), With<...>, Without<...> or Optional<...>
+             * @return Query<Terms...> The query
+             */
+            template<typename... Terms>
+            Query<Terms...> query()
+            {
+                return Query<Terms...>(*this);
+            }
+
+            /**
+             * @brief Add a component to the World
+             *
+             * @tparam Component Type of the component
+             * @throw WorldExceptionComponentsFrozen If the World is a StaticWorld, whose components are fixed
+             * @return StorageOf<Component>& Reference to the component storage
+             */
+            template<typename Component>
+            StorageOf<Component> &registerComponent()
+            {
+                auto typeIndex = std::type_index(typeid(Component));
+
+                if (_frozen) {
+                    throw WorldExceptionComponentsFrozen("The components of a static world can't change");
+                }
+                if (_components.find(typeIndex) != _components.end()) {
+                    throw WorldExceptionComponentAlreadyRegistered("Component already registered");
+                }
+                if (_usedBits.all()) {
+                    throw WorldExceptionTooManyComponents("Too many components registered");
+                }
+                std::size_t bit = 0;
+
+                while (_usedBits.test(bit)) {
+                    bit++;
+                }
+                _usedBits.set(bit);
+                _presenceVersions[bit] = 0;
+                _components[typeIndex] = std::make_pair(
+                    std::make_shared<StorageOf<Component>>(),
+                    std::make_tuple(
+                        [bit](World &aWorld, const std::size_t &aIdx) {
+                            auto &myComponent = aWorld.getComponent<Component>();
+                            const auto before = myComponent.presenceVersion();
+
+                            myComponent.init(aIdx);
+                            aWorld.acknowledgePresence(bit, before, myComponent.presenceVersion());
+                        },
+                        [bit](World &aWorld, const std::size_t &aIdx) {
+                            auto &myComponent = aWorld.getComponent<Component>();
+                            const auto before = myComponent.presenceVersion();
+
+                            myComponent.erase(aIdx);
+                            aWorld.acknowledgePresence(bit, before, myComponent.presenceVersion());
+                        },
+                        bit,
+                        [](World &aWorld, const std::size_t &aSize) {
+                            auto &myComponent = aWorld.getComponent<Component>();
+
+                            myComponent.shrinkToFit(aSize);
+                        },
+                        [](const World &aWorld) {
+                            return aWorld.getComponent<Component>().memoryStats();
+                        },
+                        [bit](World &aWorld, const std::size_t &aFrom, const std::size_t &aTo) {
+                            auto &myComponent = aWorld.getComponent<Component>();
+                            const auto before = myComponent.presenceVersion();
+
+                            myComponent.relocate(aFrom, aTo);
+                            aWorld.acknowledgePresence(bit, before, myComponent.presenceVersion());
+                        },
+                        [bit](World &aWorld) {
+                            aWorld.syncPresence(bit, std::as_const(aWorld).getComponent<Component>());
+                        }));
+                if constexpr (isDoubleBuffered<StorageOf<Component>>) {
+                    _bufferSwaps[bit] = [](World &aWorld) {
+                        return aWorld.getComponent<Component>().swap();
+                    };
+                }
+                return *std::any_cast<std::shared_ptr<StorageOf<Component>> &>(_components[typeIndex].first);
+            }
+
+            /**
+             * @brief Add multiple components to the World
+             *
+             * @tparam Components The components to add
+             */
+            template<typename... Components>
+            void registerComponents()
+            {
+                (registerComponent<Components>(), ...);
+            }
+
+            /**
+             * @brief Get the Component object
+             * @details The storage is copied first if it's still shared with a fork. The components added or removed
+             * through the storage (set, emplace, erase...) are caught up by the signatures when the next query, group
+             * or cached query runs, at the cost of a scan of the entities; the World API updates them right away
+             *
+             * @tparam Component The type of the component
+             * @return StorageOf<Component>& the storage of the component
+             */
+            template<typename Component>
+            StorageOf<Component> &getComponent()
+            {
+                auto *storage = findStorage<Component>();
+
+                if (storage == nullptr) {
+                    throw WorldExceptionComponentNotRegistered("Component not registered");
+                }
+                return *storage;
+            }
+
+            /**
+             * @brief Get the Component object
+             *
+             * @tparam Component The type of the component
+             * @return StorageOf<Component>& the storage of the component
+             */
+            template<typename Component>
+            StorageOf<Component> const &getComponent() const
+            {
+                const auto *storage = findStorage<Component>();
+
+                if (storage == nullptr) {
+                    throw WorldExceptionComponentNotRegistered("Component not registered");
+                }
+                return *storage;
+            }
+
+            /**
+             * @brief Get the storage of a component without throwing
+             * @details The storage is copied first if it's still shared with a fork
+             *
+             * @tparam Component The type of the component
+             * @return StorageOf<Component>* The storage, nullptr if the component isn't registered
+             */
+            template<typename Component>
+            StorageOf<Component> *findStorage()
+            {
+                auto found = _components.find(std::type_index(typeid(Component)));
+
+                if (found == _components.end()) {
+                    return nullptr;
+                }
+                auto &storage = std::any_cast<std::shared_ptr<StorageOf<Component>> &>(found->second.first);
+
+                if (storage.use_count() > 1) {
+                    storage = std::make_shared<StorageOf<Component>>(std::as_const(*storage));
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return storage.get();
+            }
+
+            template<typename Component>
+            [[nodiscard]] const StorageOf<Component> *findStorage() const
+            {
+                auto found = _components.find(std::type_index(typeid(Component)));
+
+                if (found == _components.end()) {
+                    return nullptr;
+                }
+                return std::any_cast<const std::shared_ptr<StorageOf<Component>> &>(found->second.first).get();
+            }
+
+            /**
+             * @brief Get the component of an entity without throwing, for the storages giving references
+             *
+             * @tparam Component The type of the component
+             * @param aIndex The index of the entity
+             * @return Component* The component, nullptr if it isn't registered or the entity doesn't have it
+             */
+            template<typename Component>
+            Component *tryGetComponent(std::size_t aIndex)
+            {
+                auto *storage = findStorage<Component>();
+
+                return storage != nullptr ? storage->tryGet(aIndex) : nullptr;
+            }
+
+            template<typename Component>
+            [[nodiscard]] const Component *tryGetComponent(std::size_t aIndex) const
+            {
+                const auto *storage = findStorage<Component>();
+
+                return storage != nullptr ? storage->tryGet(aIndex) : nullptr;
+            }
+
+            /**
+             * @brief Check if the storage of a component is still shared with a fork
+             *
+             * @tparam Component The type of the component
+             * @return true if the storage will be copied on the next write
+             * @return false if the World owns the storage
+             */
+            template<typename Component>
+            [[nodiscard]] bool isStorageShared() const
+            {
+                auto typeIndex = std::type_index(typeid(Component));
+
+                if (_components.find(typeIndex) == _components.end()) {
+                    throw WorldExceptionComponentNotRegistered("Component not registered");
+                }
+                return std::any_cast<const std::shared_ptr<StorageOf<Component>> &>(_components.at(typeIndex).first)
+                           .use_count()
+                       > 1;
+            }
+
+            /**
+             * @brief Build a resource, a value of the World that isn't bound to an entity, replacing the previous one
+             *
+             * @tparam Resource The type of the resource
+             * @param aArgs The arguments used to build the resource
+             * @return Resource& The resource inserted
+             */
+            template<typename Resource, typename... Args>
+            Resource &insertResource(Args &&...aArgs)
+            {
+                const auto family = ResourceFamily::id<Resource>();
+
+                if (family >= _resources.size()) {
+                    _resources.resize(family + 1);
+                }
+                auto *created = new Resource(std::forward<Args>(aArgs)...);
+
+                ResourceDeleter deleter {[](void *aResource) {
+                    delete static_cast<Resource *>(aResource);
+                }};
+
+                if constexpr (std::is_copy_constructible_v<Resource>) {
+                    deleter.clone = [](const void *aResource) -> void * {
+                        return new Resource(*static_cast<const Resource *>(aResource));
+                    };
+                }
+                _resources[family] = resourcePtr(created, deleter);
+                return *created;
+            }
+
+            /**
+             * @brief Get a resource, a single index lookup
+             * @throw WorldExceptionResourceNotFound if the resource wasn't inserted
+             *
+             * @tparam Resource The type of the resource
+             * @return Resource& The resource
+             */
+            template<typename Resource>
+            Resource &getResource()
+            {
+                return *static_cast<Resource *>(findResource<Resource>());
+            }
+
+            template<typename Resource>
+            const Resource &getResource() const
+            {
+                return *static_cast<const Resource *>(findResource<Resource>());
+            }
+
+            /**
+             * @brief Check if a resource was inserted
+             *
+             * @tparam Resource The type of the resource
+             * @return true if the resource exists
+             */
+            template<typename Resource>
+            [[nodiscard]] bool hasResource() const
+            {
+                const auto family = ResourceFamily::id<Resource>();
+
+                return family < _resources.size() && _resources[family] != nullptr;
+            }
+
+            /**
+             * @brief Destroy a resource, nothing happens if it doesn't exist
+             *
+             * @tparam Resource The type of the resource
+             */
+            template<typename Resource>
+            void removeResource()
+            {
+                const auto family = ResourceFamily::id<Resource>();
+
+                if (family < _resources.size()) {
+                    _resources[family].reset();
+                }
+            }
+
+            /**
+             * @brief Register an owning group: the members having all the owned components are kept packed at the
+             * front of the owned storages, in the same order
+             * @details A component can only be owned by one group, and must be stored in a PackedArray. The owned
+             * components must be removed through the World API: erasing one from its storage breaks the packing
+             *
+             * @tparam Owned The components owned by the group
+             * @throw WorldExceptionComponentAlreadyGrouped If a component is already owned by another group
+             * @return Group<Owned...> The group
+             */
+            template<typename... Owned>
+            Group<Owned...> registerGroup()
+            {
+                static_assert(sizeof...(Owned) > 0, "A group owns at least one component");
+                static_assert((IsPackedArray<StorageOf<Owned>>::value && ...),
+                              "Owned components must be stored in a PackedArray");
+                using FirstOwned = std::tuple_element_t<0, std::tuple<Owned...>>;
+
+                const auto owned = signatureOf(TypeList<Owned...> {});
+
+                for (const auto &group : _groups) {
+                    if ((group.owned & owned).any()) {
+                        throw WorldExceptionComponentAlreadyGrouped("Component already owned by a group");
+                    }
+                }
+                _groups.push_back(GroupData {
+                    owned, 0,
+                    [](World &aWorld, GroupData &aGroup, id aIdx) {
+                        if ((aWorld.getEntitySignature(aIdx) & aGroup.owned) != aGroup.owned
+                            || aWorld.getComponent<FirstOwned>().indexOf(aIdx) < aGroup.size) {
+                            return;
+                        }
+                        (aWorld.getComponent<Owned>().swapEntries(aWorld.getComponent<Owned>().indexOf(aIdx),
+                                                                  aGroup.size),
+                         ...);
+                        aGroup.size++;
+                    },
+                    [](World &aWorld, GroupData &aGroup, id aIdx) {
+                        const auto position = aWorld.getComponent<FirstOwned>().indexOf(aIdx);
+
+                        if (position == PackedArray<FirstOwned>::npos || position >= aGroup.size) {
+                            return;
+                        }
+                        aGroup.size--;
+                        (aWorld.getComponent<Owned>().swapEntries(aWorld.getComponent<Owned>().indexOf(aIdx),
+                                                                  aGroup.size),
+                         ...);
+                    }});
+
+                auto &group = _groups.back();
+                const auto members = getComponent<FirstOwned>().entities();
+
+                for (const auto entity : std::vector<id>(members.begin(), members.end())) {
+                    group.enter(*this, group, entity);
+                }
+                return Group<Owned...>(*this, _groups.size() - 1);
+            }
+
+            /**
+             * @brief Get a registered owning group
+             *
+             * @tparam Owned The components owned by the group, all of them
+             * @throw WorldExceptionGroupNotRegistered If no group owns exactly these components
+             * @return Group<Owned...> The group
+             */
+            template<typename... Owned>
+            Group<Owned...> group()
+            {
+                const auto owned = signatureOf(TypeList<Owned...> {});
+
+                for (std::size_t idx = 0; idx < _groups.size(); idx++) {
+                    if (_groups[idx].owned == owned) {
+                        return Group<Owned...>(*this, idx);
+                    }
+                }
+                throw WorldExceptionGroupNotRegistered("Group not registered");
+            }
+
+            /**
+             * @brief Register a cached query: the entities matching the terms are kept in a packed list, updated
+             * incrementally when components are added to or removed from the entities
+             * @details Registering the same terms twice gives the same cache
+             *
+             * @tparam Terms Components, With<...>, Without<...> or Optional<...>
+             * @return CachedQuery<Terms...> The cached query
+             */
+            template<typename... Terms>
+            CachedQuery<Terms...> registerQuery()
+            {
+                return CachedQuery<Terms...>(*this, registerQueryCache(signatureOf(QueryRequired<Terms...> {}),
+                                                                       signatureOf(QueryExcluded<Terms...> {})));
+            }
+
+            /**
+             * @brief Get a registered cached query
+             *
+             * @tparam Terms The terms the query was registered with
+             * @throw WorldExceptionQueryNotRegistered If no cached query has the same required and excluded components
+             * @return CachedQuery<Terms...> The cached query
+             */
+            template<typename... Terms>
+            CachedQuery<Terms...> cachedQuery()
+            {
+                const auto required = signatureOf(QueryRequired<Terms...> {});
+                const auto excluded = signatureOf(QueryExcluded<Terms...> {});
+
+                for (std::size_t idx = 0; idx < _queryCaches.size(); idx++) {
+                    if (_queryCaches[idx].isOf(required, excluded)) {
+                        return CachedQuery<Terms...>(*this, idx);
+                    }
+                }
+                throw WorldExceptionQueryNotRegistered("Query not registered");
+            }
+
+            /**
+             * @brief Check if the entity has all the components
+             *
+             * @tparam Components The components to check
+             * @param aIndex The index of the entity
+             * @return true if the entity has all the components
+             * @return false if the entity doesn't have all the components
+             */
+            template<typename... Components>
+            [[nodiscard]] bool hasComponents(std::size_t aIndex) const
+            {
+                return (... && getComponent<Components>().has(aIndex));
+            }
+
+            /**
+             * @brief Remove a component
+             *
+             * @tparam Component The type of the component
+             * @throw WorldExceptionComponentsFrozen If the World is a StaticWorld, whose components are fixed
+             */
+            template<typename Component>
+            void removeComponent()
+            {
+                auto typeIndex = std::type_index(typeid(Component));
+
+                if (_frozen) {
+                    throw WorldExceptionComponentsFrozen("The components of a static world can't change");
+                }
+
+                if (_components.find(typeIndex) == _components.end()) {
+                    throw WorldExceptionComponentNotRegistered("Component not registered");
+                }
+                const auto bit = std::get<2>(_components[typeIndex].second);
+
+                for (auto &group : _groups) {
+                    if (group.owned.test(bit)) {
+                        group.drop();
+                    }
+                }
+                for (auto &cache : _queryCaches) {
+                    if (cache.required.test(bit) || cache.excluded.test(bit)) {
+                        cache.drop();
+                    }
+                }
+                for (auto &entitySignature : _signatures) {
+                    entitySignature.reset(bit);
+                }
+                if (bit < _stateHashes.size()) {
+                    _stateHashes[bit] = StateHash {};
+                }
+                _bufferSwaps.erase(bit);
+                _usedBits.reset(bit);
+                _components.erase(typeIndex);
+            }
+
+            /**
+             * @brief Add a component to an entity
+             *
+             * @tparam Component The type of the component to add
+             * @param aIndex The index of the entity
+             * @param aComponent The component to add
+             * @return decltype(auto) The component added, a copy for the SoA components
+             */
+            template<typename Component>
+            decltype(auto) addComponentToEntity(std::size_t aIndex, Component &&aComponent)
+            {
+                auto &component = getComponent<Component>();
+                const auto bit = getComponentBit<Component>();
+                const auto before = component.presenceVersion();
+
+                component.set(aIndex, std::forward<Component>(aComponent));
+                acknowledgePresence(bit, before, component.presenceVersion());
+                componentAdded(bit, aIndex);
+                return component.get(aIndex);
+            }
+
+            /**
+             * @brief Add a component to an entity without throwing
+             *
+             * @tparam Component The type of the component to add
+             * @param aIndex The index of the entity
+             * @param aComponent The component to add
+             * @return Expected<void, WorldError> Nothing, or ComponentNotRegistered or EntityOutOfRange
+             */
+            template<typename Component>
+            Expected<void, WorldError> tryAddComponentToEntity(std::size_t aIndex, Component &&aComponent)
+            {
+                return tryEmplaceComponentToEntity<std::remove_cvref_t<Component>>(aIndex,
+                                                                                    std::forward<Component>(aComponent));
+            }
+
+            /**
+             * @brief Build and add a component to an entity
+             *
+             * @tparam Component The type of the component to add
+             * @tparam Args The types of the arguments to pass to the component constructor (infered)
+             * @param aIndex The index of the entity
+             * @param aArgs The arguments to pass to the component constructor
+             * @return decltype(auto) The component added, a copy for the SoA components
+             */
+            template<typename Component, typename... Args>
+            decltype(auto) emplaceComponentToEntity(std::size_t aIndex, Args &&...aArgs)
+            {
+                auto &component = getComponent<Component>();
+                const auto bit = getComponentBit<Component>();
+                const auto before = component.presenceVersion();
+
+                component.emplace(aIndex, std::forward<Args>(aArgs)...);
+                acknowledgePresence(bit, before, component.presenceVersion());
+                componentAdded(bit, aIndex);
+                return component.get(aIndex);
+            }
+
+            /**
+             * @brief Build and add a component to an entity without throwing
+             *
+             * @tparam Component The type of the component to add
+             * @tparam Args The types of the arguments to pass to the component constructor (infered)
+             * @param aIndex The index of the entity
+             * @param aArgs The arguments to pass to the component constructor
+             * @return Expected<void, WorldError> Nothing, or ComponentNotRegistered or EntityOutOfRange
+             */
+            template<typename Component, typename... Args>
+            Expected<void, WorldError> tryEmplaceComponentToEntity(std::size_t aIndex, Args &&...aArgs)
+            {
+                auto found = _components.find(std::type_index(typeid(Component)));
+
+                if (found == _components.end()) {
+                    return Unexpected(WorldError::ComponentNotRegistered);
+                }
+                if (aIndex >= _nextId) {
+                    return Unexpected(WorldError::EntityOutOfRange);
+                }
+                auto &component = *findStorage<Component>();
+                const auto bit = std::get<2>(found->second.second);
+                const auto before = component.presenceVersion();
+
+                component.emplace(aIndex, std::forward<Args>(aArgs)...);
+                acknowledgePresence(bit, before, component.presenceVersion());
+                componentAdded(bit, aIndex);
+                return {};
+            }
+
+            /**
+             * @brief Remove a component from an entity
+             *
+             * @tparam Component The type of the component to remove
+             * @param aIndex The index of the entity
+             */
+            template<typename Component>
+            void removeComponentFromEntity(std::size_t aIndex)
+            {
+                auto &component = getComponent<Component>();
+                const auto bit = getComponentBit<Component>();
+                const auto before = component.presenceVersion();
+
+                componentRemoved(bit, aIndex);
+                component.erase(aIndex);
+                acknowledgePresence(bit, before, component.presenceVersion());
+            }
+
+            /**
+             * @brief Remove a component from an entity without throwing
+             *
+             * @tparam Component The type of the component to remove
+             * @param aIndex The index of the entity
+             * @return Expected<void, WorldError> Nothing, or ComponentNotRegistered, EntityOutOfRange or
+             * ComponentMissing
+             */
+            template<typename Component>
+            Expected<void, WorldError> tryRemoveComponentFromEntity(std::size_t aIndex)
+            {
+                auto found = _components.find(std::type_index(typeid(Component)));
+
+                if (found == _components.end()) {
+                    return Unexpected(WorldError::ComponentNotRegistered);
+                }
+                if (aIndex >= _nextId) {
+                    return Unexpected(WorldError::EntityOutOfRange);
+                }
+                const auto bit = std::get<2>(found->second.second);
+
+                if (!getSignature(aIndex).test(bit)) {
+                    return Unexpected(WorldError::ComponentMissing);
+                }
+                auto &component = *findStorage<Component>();
+                const auto before = component.presenceVersion();
+
+                componentRemoved(bit, aIndex);
+                component.erase(aIndex);
+                acknowledgePresence(bit, before, component.presenceVersion());
+                return {};
+            }
+
+            /**
+             * @brief Keep an incremental hash of a component storage, e.g. to detect a desync between peers
+             * @details The slots written since the last hash are rehashed: the components added or removed, and the
+             * ones given by non-const reference to a query or a group. Call markWritten after writing through
+             * getComponent
+             *
+             * @tparam Component The type of the component, hashed with ComponentHash
+             */
+            template<typename Component>
+            void trackStateHash()
+            {
+                static_assert(HashableComponent<Component>, "Specialize ComponentHash to hash this component");
+                const auto bit = getComponentBit<Component>();
+
+                if (_stateHashes.size() < maxComponents) {
+                    _stateHashes.resize(maxComponents);
+                }
+                _stateHashes[bit].track(
+                    [bit](const World &aWorld, std::size_t aIdx) -> std::uint64_t {
+                        if (!aWorld.getEntitySignature(aIdx).test(bit)) {
+                            return 0;
+                        }
+                        return mixHash(ComponentHash<Component> {}(aWorld.getComponent<Component>().get(aIdx))
+                                       ^ mixHash(aIdx));
+                    },
+                    _nextId);
+            }
+
+            /**
+             * @brief Flag the component of an entity as written, for the state hash
+             *
+             * @tparam Component The type of the component
+             * @param aIndex The index of the entity
+             */
+            template<typename Component>
+            void markWritten(std::size_t aIndex)
+            {
+                if (auto *hash = findStateHash(getComponentBit<Component>())) {
+                    hash->markWritten(aIndex);
+                }
+            }
+
+            /**
+             * @brief Get the hash of a component storage, its written slots are rehashed first
+             *
+             * @tparam Component The type of the component
+             * @throw WorldExceptionStateHashNotTracked If trackStateHash wasn't called for the component
+             * @return std::uint64_t The hash
+             */
+            template<typename Component>
+            std::uint64_t getStateHash()
+            {
+                auto &hash = flushStateHash(getComponentBit<Component>());
+
+                return hash.digest();
+            }
+
+            /**
+             * @brief Get the hash of each entity slot of a component storage, to find the entity peers diverge on
+             *
+             * @tparam Component The type of the component
+             * @throw WorldExceptionStateHashNotTracked If trackStateHash wasn't called for the component
+             * @return std::span<const std::uint64_t> The hashes, 0 for an entity without the component
+             */
+            template<typename Component>
+            std::span<const std::uint64_t> getSlotHashes()
+            {
+                return flushStateHash(getComponentBit<Component>()).slotHashes();
+            }
+
+            /**
+             * @brief Get the hash of all the tracked storages, deterministic for the same components on every peer
+             *
+             * @return std::uint64_t The hash
+             */
+            std::uint64_t getStateHash();
+
+            /**
+             * @brief Fork the World, e.g. to simulate a few ticks ahead
+             * @details The component storages are shared with the fork and copied by the first one of the two Worlds
+             * getting them for writing, so a fork only costs the storages it modifies. A storage is copied whole, not
+             * page by page: the first write to one component of a shared storage copies all of that component's
+             * slots, in O(entities) time and memory. The entities, the groups, the cached queries and the copyable
+             * resources are copied, the systems, the scripts and the timers aren't.
+             * A reference to a storage taken before the fork still points at the storage shared with the fork, so
+             * writing through it changes the fork too: get the storages again with getComponent after forking
+             *
+             * @return World The fork
+             */
+            [[nodiscard]] World fork() const;
+
+            /**
+             * @brief Kill an entity
+             * @details Call erase from each component on the entity, then add the id as a free id
+             * @param aIndex The index of the entity to kill
+             */
+            void killEntity(std::size_t aIndex);
+
+            /**
+             * @brief Create an entity
+             * @details Get the next free id, call init from each component on the entity, then return the id
+             * @return std::size_t The id of the entity
+             */
+            std::size_t createEntity();
+
+            /**
+             * @brief Create an entity known by an external id, e.g. the 64-bit id assigned by a server
+             * @details The entity gets a regular World id, the external one is only kept in a hash map, so sparse
+             * external ids don't grow the storages
+             *
+             * @param aExternal The external id
+             * @throw EntityIndexExceptionAlreadyBound If an entity already has this external id
+             * @return std::size_t The id of the entity
+             */
+            std::size_t createEntity(EntityIndex::externalId aExternal);
+
+            /**
+             * @brief Get the entity created with an external id
+             *
+             * @param aExternal The external id
+             * @return std::size_t The id of the entity, nullId if none is alive
+             */
+            [[nodiscard]] std::size_t findEntity(EntityIndex::externalId aExternal) const;
+
+            /**
+             * @brief Get the external id of an entity
+             *
+             * @param aIndex The id of the entity
+             * @return EntityIndex::externalId The external id, EntityIndex::noExternalId if it has none
+             */
+            [[nodiscard]] EntityIndex::externalId getExternalId(std::size_t aIndex) const;
+
+            /**
+             * @brief Add a system to the world
+             * @details A system running every few ticks gets the next phase among the systems of the same interval
+             *
+             * @tparam Components The components the system will use
+             * @tparam Function The type of the system (infered)
+             * @param aFunction The system to add
+             */
+            void addSystem(newSystemFunc &aSystem)
+            {
+                if (_systems.find(aSystem.first) != _systems.end()) {
+                    throw WorldExceptionSystemAlreadyRegistered("System already registered");
+                }
+                const auto interval = aSystem.second->getInterval();
+
+                if (interval > 1) {
+                    const auto sameInterval = std::count_if(_systems.begin(), _systems.end(), [interval](auto &aOther) {
+                        return aOther.second->getInterval() == interval;
+                    });
+
+                    aSystem.second->setPhase(static_cast<std::size_t>(sameInterval) % interval);
+                }
+                _systems[aSystem.first] = std::move(aSystem.second);
+                _systemNames.clear();
+            }
 
-            template<typename... Components>
-            class Query
+            /**
+             * @brief Get a system, e.g. to change its interval, slices or budget
+             *
+             * @param aName The name of the system
+             * @throw WorldExceptionSystemNotRegistered If no system has this name
+             * @return System& The system
+             */
+            System &getSystem(const std::string &aName)
             {
-                public:
-                    explicit Query(Core::World &world)
-                        : _world(world)
-                    {}
+                auto found = _systems.find(aName);
 
-                    void
-                    forEach(double deltaTime,
-                            std::function<void(World &world, double deltaTime, std::size_t idx, Components &...)> func)
-                    {
-                        for (std::size_t idx = 0; idx < _world.get().getCurrentId(); idx++) {
-                            if (_world.get().hasComponents<Components...>(idx)) {
-                                func(_world.get(), deltaTime, idx, _world.get().getComponent<Components>().get(idx)...);
-                            }
-                        }
-                    }
+                if (found == _systems.end()) {
+                    throw WorldExceptionSystemNotRegistered("System not registered");
+                }
+                return *found->second;
+            }
 
-                private:
-                    std::reference_wrapper<Core::World> _world;
-            };
+            /**
+             * @brief Remove a system from the world
+             *
+             * @tparam Function The type of the system (infered)
+             * @param aFunction The system to remove
+             */
+            void removeSystem(std::string &aFuncName)
+            {
+                if (_systems.find(aFuncName) == _systems.end()) {
+                    throw WorldExceptionSystemNotRegistered("System not registered");
+                }
 
-        public:
-#pragma region constructors / destructors
-            World() = default;
-            ~World() = default;
+                _systems.erase(aFuncName);
+                _systemNames.clear();
+            }
 
-            World(const World &other) = default;
-            World &operator=(const World &other) = default;
+            /**
+             * @brief Run the systems due on this tick, then resume the scripts that are due, fire the timers of the
+             * tick and swap the double buffered components
+             * @details The scripts are advanced by the time elapsed since the last call. With ENGINE_PROFILING, records
+             * the frame, each system update, the scripts, the timers and the buffer swaps
+             */
+            void runSystems();
 
-            World(World &&other) noexcept = default;
-            World &operator=(World &&other) noexcept = default;
-#pragma endregion constructors / destructors
+            /**
+             * @brief Run the systems due on this tick, the scripts being advanced by the duration of the tick
+             * @details Used by App, which gives each step of a fixed rate world its period so the seconds waited by
+             * the scripts are simulated time, like the ticks of the timers, even when the steps are caught up at once
+             *
+             * @param aDeltaTime The duration of the tick, in seconds
+             */
+            void runSystems(double aDeltaTime);
 
-#pragma region methods
+            /**
+             * @brief Close the tick of the double buffered components: the slots written since the last call become
+             * their previous state
+             * @details Called by runSystems after the timers, call it by hand when the systems are run another way
+             *
+             * @return std::size_t The number of slots copied
+             */
+            std::size_t swapBuffers();
 
-            template<typename... Components>
-            Query<Components...> query()
-            {
-                return Query<Components...>(*this);
-            }
+            /**
+             * @brief Get the number of calls to runSystems
+             *
+             * @return std::size_t The current tick
+             */
+            [[nodiscard]] std::size_t getTick() const;
 
             /**
-             * @brief Add a component to the World
+             * @brief Start a script, it runs until its first suspension then is resumed by runSystems
+             * @throw The exception thrown by the script
+             * @param aScript The script
+             */
+            void startScript(Script &&aScript);
+
+            /**
+             * @brief Start a script bound to an entity, it is stopped when the entity is killed
+             * @throw The exception thrown by the script
+             * @param aIndex The entity
+             * @param aScript The script
+             */
+            void startScript(std::size_t aIndex, Script &&aScript);
+
+            /**
+             * @brief Get the scheduler of the scripts
              *
-             * @tparam Component Type of the component
-             * @return SparseArray<Component>& Reference to the component SparseArray
+             * @return ScriptScheduler& The scheduler
              */
-            template<typename Component>
-            SparseArray<Component> &registerComponent()
-            {
-                auto typeIndex = std::type_index(typeid(Component));
+            ScriptScheduler &getScheduler();
 
-                if (_components.find(typeIndex) != _components.end()) {
-                    throw WorldExceptionComponentAlreadyRegistered("Component already registered");
-                }
-                _components[typeIndex] = std::make_pair(SparseArray<Component>(),
-                                                        std::make_tuple(
-                                                            [](World &aWorld, const std::size_t &aIdx) {
-                                                                auto &myComponent = aWorld.getComponent<Component>();
+            /**
+             * @brief Call a function after a number of ticks, a tick being a call to runSystems
+             *
+             * @param aDelay The number of ticks, at least 1
+             * @param aFunc The function, given the World
+             * @return TimerWheel::timerId The timer, to cancel it
+             */
+            TimerWheel::timerId addTimer(TimerWheel::tick aDelay, TimerWheel::timerFunc aFunc);
 
-                                                                myComponent.init(aIdx);
-                                                            },
-                                                            [](World &aWorld, const std::size_t &aIdx) {
-                                                                auto &myComponent = aWorld.getComponent<Component>();
+            /**
+             * @brief Call a function after a number of ticks, cancelled when the entity is killed
+             *
+             * @param aIndex The entity
+             * @param aDelay The number of ticks, at least 1
+             * @param aFunc The function, given the World
+             * @return TimerWheel::timerId The timer, to cancel it
+             */
+            TimerWheel::timerId addTimer(std::size_t aIndex, TimerWheel::tick aDelay, TimerWheel::timerFunc aFunc);
 
-                                                                myComponent.erase(aIdx);
-                                                            }));
-                return std::any_cast<SparseArray<Component> &>(_components[typeIndex].first);
+            /**
+             * @brief Push an event to the EventManager after a number of ticks
+             *
+             * @tparam EventType The type of the event
+             * @param aDelay The number of ticks, at least 1
+             * @param aEvent The event
+             * @return TimerWheel::timerId The timer, to cancel it
+             */
+            template<typename EventType>
+            TimerWheel::timerId addTimerEvent(TimerWheel::tick aDelay, EventType aEvent)
+            {
+                return addTimer(aDelay, [aEvent = std::move(aEvent)](World & /*aWorld*/) {
+                    Event::EventManager::getInstance().pushEvent(aEvent);
+                });
             }
 
             /**
-             * @brief Add multiple components to the World
+             * @brief Push an event to the EventManager after a number of ticks, cancelled when the entity is killed
              *
-             * @tparam Components The components to add
+             * @tparam EventType The type of the event
+             * @param aIndex The entity
+             * @param aDelay The number of ticks, at least 1
+             * @param aEvent The event
+             * @return TimerWheel::timerId The timer, to cancel it
              */
-            template<typename... Components>
-            void registerComponents()
+            template<typename EventType>
+            TimerWheel::timerId addTimerEvent(std::size_t aIndex, TimerWheel::tick aDelay, EventType aEvent)
             {
-                (registerComponent<Components>(), ...);
+                return addTimer(aIndex, aDelay, [aEvent = std::move(aEvent)](World & /*aWorld*/) {
+                    Event::EventManager::getInstance().pushEvent(aEvent);
+                });
             }
 
             /**
-             * @brief Get the Component object
+             * @brief Cancel a timer, nothing happens if it already fired
+             *
+             * @param aTimer The timer
+             * @return true if the timer was pending
+             * @return false otherwise
+             */
+            bool cancelTimer(TimerWheel::timerId aTimer);
+
+            /**
+             * @brief Get the timers, advanced by runSystems
+             *
+             * @return TimerWheel& The timers
+             */
+            TimerWheel &getTimers();
+
+            /**
+             * @brief Get the memory used by the storage of a component
+             * @throw WorldExceptionComponentNotRegistered if the component is not registered
              *
              * @tparam Component The type of the component
-             * @return SparseArray<Component>& the SparseArray of the component
+             * @return MemoryStats The memory used
              */
             template<typename Component>
-            SparseArray<Component> &getComponent()
+            [[nodiscard]] MemoryStats getMemoryStats() const
             {
-                auto typeIndex = std::type_index(typeid(Component));
-
-                if (_components.find(typeIndex) == _components.end()) {
-                    throw WorldExceptionComponentNotRegistered("Component not registered");
-                }
-                return std::any_cast<SparseArray<Component> &>(_components[typeIndex].first);
+                return getComponent<Component>().memoryStats();
             }
 
             /**
-             * @brief Get the Component object
+             * @brief Get the memory used by all the storages
+             * @details The reserved bytes also count the signatures, the freed ids, the cached queries and the external
+             * ids of the World
+             *
+             * @return MemoryStats The memory used
+             */
+            [[nodiscard]] MemoryStats getMemoryStats() const;
+
+            /**
+             * @brief Release the memory left by the killed entities
+             * @details The freed ids at the end of the id range are forgotten, so the current id goes down, then every
+             * storage drops its trailing empty slots and gives back its unused capacity. Live entities keep their id.
+             */
+            void compact();
+
+            /**
+             * @brief Renumber the live entities into 0 to their count - 1, keeping their order, then compact the World
+             * @details Every component and signature is moved to the new id, groups are kept. Ids held outside of the
+             * World (in systems, events, over the network...) must be patched with the returned table.
+             *
+             * @return idRemap The new id of each old id, nullId for the ids that were not alive
+             */
+            idRemap defragment();
+
+            /**
+             * @brief Get the profiler filled by runSystems
+             *
+             * @return Profiler& The profiler
+             */
+            Profiler &getProfiler();
+
+            [[nodiscard]] const Profiler &getProfiler() const;
+
+            /**
+             * @brief Get the bit used for a component in the entity signatures
              *
              * @tparam Component The type of the component
-             * @return SparseArray<Component>& the SparseArray of the component
+             * @throw WorldExceptionComponentNotRegistered If the component isn't registered
+             * @return std::size_t The index of the bit
              */
             template<typename Component>
-            SparseArray<Component> const &getComponent() const
+            [[nodiscard]] std::size_t getComponentBit() const
             {
                 auto typeIndex = std::type_index(typeid(Component));
+                auto found = _components.find(typeIndex);
 
-                if (_components.find(typeIndex) == _components.end()) {
+                if (found == _components.end()) {
                     throw WorldExceptionComponentNotRegistered("Component not registered");
                 }
-                return std::any_cast<SparseArray<Component> const &>(_components.at(typeIndex).first);
+                return std::get<2>(found->second.second);
             }
 
             /**
-             * @brief Check if the entity has all the components
+             * @brief Get the signature of an entity, one bit set per component it has
              *
-             * @tparam Components The components to check
              * @param aIndex The index of the entity
-             * @return true if the entity has all the components
-             * @return false if the entity doesn't have all the components
+             * @return signature The signature, empty if the entity doesn't exist
              */
-            template<typename... Components>
-            [[nodiscard]] bool hasComponents(std::size_t aIndex) const
+            [[nodiscard]] signature getEntitySignature(std::size_t aIndex) const
             {
-                return (... && getComponent<Components>().has(aIndex));
+                return aIndex < _signatures.size() ? _signatures[aIndex] : signature {};
             }
 
             /**
-             * @brief Remove a component
+             * @brief Get the Current Id object
              *
-             * @tparam Component The type of the component
+             * @return std::size_t The current id
              */
-            template<typename Component>
-            void removeComponent()
-            {
-                auto typeIndex = std::type_index(typeid(Component));
+            [[nodiscard]] std::size_t getCurrentId() const;
 
-                if (_components.find(typeIndex) == _components.end()) {
-                    throw WorldExceptionComponentNotRegistered("Component not registered");
+        protected:
+            /**
+             * @brief Get the signature of an entity, grows the signatures if needed
+             *
+             * @param aIndex The index of the entity
+             * @return signature& The signature of the entity
+             */
+            signature &getSignature(std::size_t aIndex)
+            {
+                if (aIndex >= _signatures.size()) {
+                    _signatures.resize(aIndex + 1);
                 }
-                _components.erase(typeIndex);
+                return _signatures[aIndex];
             }
 
             /**
-             * @brief Add a component to an entity
+             * @brief Take the smallest free id, or the next one, with an empty signature
+             *
+             * @return id The id of the new entity, its components are not initialized
+             */
+            id allocateEntity();
+
+            /**
+             * @brief Detach an entity from the groups, the cached queries, the scripts, the timers and the external
+             * ids, clear its signature and free its id
+             * @details The components are left to the caller
              *
-             * @tparam Component The type of the component to add
              * @param aIndex The index of the entity
-             * @param aComponent The component to add
-             * @return Component& The component added
              */
-            template<typename Component>
-            Component &addComponentToEntity(std::size_t aIndex, Component &&aComponent)
-            {
-                try {
-                    auto &component = getComponent<Component>();
+            void releaseEntity(id aIndex);
 
-                    component.set(aIndex, std::forward<Component>(aComponent));
-                    return component.get(aIndex);
-                } catch (WorldExceptionComponentNotRegistered &e) {
-                    throw WorldExceptionComponentNotRegistered("Component not registered");
+            /**
+             * @brief Update the entity signature, the groups and the cached queries after a component was added to the entity
+             *
+             * @param aBit The bit of the component
+             * @param aIndex The index of the entity
+             */
+            void componentAdded(std::size_t aBit, std::size_t aIndex)
+            {
+                getSignature(aIndex).set(aBit);
+                for (auto &group : _groups) {
+                    if (group.owned.test(aBit)) {
+                        group.enter(*this, group, aIndex);
+                    }
+                }
+                updateQueryCaches(aIndex, signature {}.set(aBit));
+                if (auto *hash = findStateHash(aBit)) {
+                    hash->markWritten(aIndex);
                 }
             }
 
             /**
-             * @brief Build and add a component to an entity
+             * @brief Update the groups, the entity signature and the cached queries when a component is removed from the
+             * entity
              *
-             * @tparam Component The type of the component to add
-             * @tparam Args The types of the arguments to pass to the component constructor (infered)
+             * @param aBit The bit of the component
              * @param aIndex The index of the entity
-             * @param aArgs The arguments to pass to the component constructor
-             * @return Component& The component added
              */
-            template<typename Component, typename... Args>
-            Component &emplaceComponentToEntity(std::size_t aIndex, Args &&...aArgs)
+            void componentRemoved(std::size_t aBit, std::size_t aIndex)
             {
-                try {
-                    auto &component = getComponent<Component>();
+                for (auto &group : _groups) {
+                    if (group.owned.test(aBit)) {
+                        group.leave(*this, group, aIndex);
+                    }
+                }
+                getSignature(aIndex).reset(aBit);
+                updateQueryCaches(aIndex, signature {}.set(aBit));
+                if (auto *hash = findStateHash(aBit)) {
+                    hash->markWritten(aIndex);
+                }
+            }
 
-                    component.emplace(aIndex, std::forward<Args>(aArgs)...);
-                    return component.get(aIndex);
-                } catch (WorldExceptionComponentNotRegistered &e) {
-                    throw WorldExceptionComponentNotRegistered("Component not registered");
+            /**
+             * @brief Check if an id belongs to a living entity
+             *
+             * @param aIndex The id
+             * @return true if the entity was created and not killed
+             */
+            [[nodiscard]] bool isAlive(id aIndex) const
+            {
+                return aIndex < _alive.size() && _alive[aIndex] != 0;
+            }
+
+            /**
+             * @brief Record a change of a storage made by the World itself, the signatures being updated by the caller
+             * @details The change is only taken as seen if the storage was in sync before it, otherwise the next
+             * syncPresence still rescans the storage
+             *
+             * @param aBit The bit of the component
+             * @param aBefore The presence version of the storage before the change
+             * @param aAfter The presence version of the storage after the change
+             */
+            void acknowledgePresence(std::size_t aBit, std::uint64_t aBefore, std::uint64_t aAfter)
+            {
+                if (_presenceVersions[aBit] == aBefore) {
+                    _presenceVersions[aBit] = aAfter;
                 }
             }
 
             /**
-             * @brief Remove a component from an entity
+             * @brief Update the signatures, the groups and the cached queries after components were added or removed
+             * through a storage instead of the World API
+             * @details Nothing is done if the presence version of the storage didn't move, otherwise the living entities
+             * are rescanned
              *
-             * @tparam Component The type of the component to remove
-             * @param aIndex The index of the entity
+             * @param aBit The bit of the component
+             * @param aStorage The storage of the component
              */
-            template<typename Component>
-            void removeComponentFromEntity(std::size_t aIndex)
+            template<typename Storage>
+            void syncPresence(std::size_t aBit, const Storage &aStorage)
             {
-                try {
-                    auto &component = getComponent<Component>();
+                const auto version = aStorage.presenceVersion();
 
-                    component.erase(aIndex);
-                } catch (WorldExceptionComponentNotRegistered &e) {
-                    throw WorldExceptionComponentNotRegistered("Component not registered");
+                if (version == _presenceVersions[aBit]) {
+                    return;
+                }
+                _presenceVersions[aBit] = version;
+                for (id idx = 0; idx < _nextId; idx++) {
+                    const auto present = aStorage.contains(idx);
+
+                    if (!isAlive(idx) || present == getSignature(idx).test(aBit)) {
+                        continue;
+                    }
+                    if (present) {
+                        componentAdded(aBit, idx);
+                    } else {
+                        componentRemoved(aBit, idx);
+                    }
                 }
             }
 
             /**
-             * @brief Kill an entity
-             * @details Call erase from each component on the entity, then add the id as a free id
-             * @param aIndex The index of the entity to kill
+             * @brief Sync the signatures with every storage, called before the entities are matched
              */
-            void killEntity(std::size_t aIndex);
+            void syncPresence();
 
             /**
-             * @brief Create an entity
-             * @details Get the next free id, call init from each component on the entity, then return the id
-             * @return std::size_t The id of the entity
+             * @brief Intern the names of the systems, then of the scripts, timers and buffers steps, in the order
+             * runSystems records them
              */
-            std::size_t createEntity();
+            void indexSystemNames();
 
             /**
-             * @brief Add a system to the world
+             * @brief Add or remove an entity from the cached queries using the changed components
              *
-             * @tparam Components The components the system will use
-             * @tparam Function The type of the system (infered)
-             * @param aFunction The system to add
+             * @param aIndex The index of the entity
+             * @param aChanged The bits of the changed components, all of them to check every cached query
              */
-            void addSystem(newSystemFunc &aSystem)
+            void updateQueryCaches(std::size_t aIndex, const signature &aChanged);
+
+            /**
+             * @brief Find the cache of the given components or build a new one from the living entities
+             *
+             * @param aRequired The components the entities must have
+             * @param aExcluded The components the entities must not have
+             * @return std::size_t The index of the cache
+             */
+            std::size_t registerQueryCache(const signature &aRequired, const signature &aExcluded);
+
+            /**
+             * @brief Refill a cache from the living entities
+             *
+             * @param aCache The cache
+             */
+            void rebuildQueryCache(QueryCacheData &aCache);
+
+            /**
+             * @brief Build the signature made of the bits of the components
+             *
+             * @tparam Components The components
+             * @return signature The signature
+             */
+            template<typename... Components>
+            signature signatureOf(TypeList<Components...> /*unused*/) const
             {
-                if (_systems.find(aSystem.first) != _systems.end()) {
-                    throw WorldExceptionSystemAlreadyRegistered("System already registered");
-                }
+                signature result;
 
-                _systems[aSystem.first] = std::move(aSystem.second);
+                (result.set(getComponentBit<Components>()), ...);
+                return result;
             }
 
             /**
-             * @brief Remove a system from the world
+             * @brief Get the bits of the components stored as a TagArray
              *
-             * @tparam Function The type of the system (infered)
-             * @param aFunction The system to remove
+             * @tparam Components The components
+             * @return std::vector<const TagBits *> The bits of the tags among the components
              */
-            void removeSystem(std::string &aFuncName)
+            template<typename... Components>
+            std::vector<const TagBits *> tagBitsOf(TypeList<Components...> /*unused*/)
             {
-                if (_systems.find(aFuncName) == _systems.end()) {
-                    throw WorldExceptionSystemNotRegistered("System not registered");
-                }
+                std::vector<const TagBits *> result;
 
-                _systems.erase(aFuncName);
+                (
+                    [this, &result]() {
+                        if constexpr (IsTagArray<StorageOf<Components>>::value) {
+                            result.push_back(&getComponent<Components>());
+                        }
+                    }(),
+                    ...);
+                return result;
             }
 
             /**
-             * @brief Run all the systems once
+             * @brief Get the state hash of a component if it's tracked
              *
+             * @param aBit The bit of the component
+             * @return StateHash* The state hash, nullptr if it isn't tracked
              */
-            void runSystems();
+            StateHash *findStateHash(std::size_t aBit)
+            {
+                return aBit < _stateHashes.size() && _stateHashes[aBit].isTracked() ? &_stateHashes[aBit] : nullptr;
+            }
 
             /**
-             * @brief Get the Current Id object
+             * @brief Get the state hash of a component grown to hold every entity, so the jobs of a parallel query
+             * can flag their slots without growing it
              *
-             * @return std::size_t The current id
+             * @param aBit The bit of the component
+             * @return StateHash* The state hash, nullptr if it isn't tracked
              */
-            [[nodiscard]] std::size_t getCurrentId() const;
+            StateHash *writtenStateHash(std::size_t aBit)
+            {
+                auto *hash = findStateHash(aBit);
+
+                if (hash != nullptr) {
+                    hash->reserve(_nextId);
+                }
+                return hash;
+            }
+
+            /**
+             * @brief Rehash the written slots of a component
+             *
+             * @param aBit The bit of the component
+             * @throw WorldExceptionStateHashNotTracked If the component isn't tracked
+             * @return StateHash& The state hash
+             */
+            StateHash &flushStateHash(std::size_t aBit);
+
+            template<typename Resource>
+            void *findResource() const
+            {
+                if (!hasResource<Resource>()) {
+                    throw WorldExceptionResourceNotFound("Resource not found");
+                }
+                return _resources[ResourceFamily::id<Resource>()].get();
+            }
 
-        protected:
             /**
              * @brief Get the Init Func used to init the component
              *
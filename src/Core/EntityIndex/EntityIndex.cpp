@@ -0,0 +1,89 @@
+#include "EntityIndex.hpp"
+#include <string>
+#include <utility>
+
+namespace Engine::Core {
+    void EntityIndex::bind(externalId aExternal, std::size_t aLocal)
+    {
+        if (_locals.contains(aExternal) || externalOf(aLocal) != noExternalId) {
+            throw EntityIndexExceptionAlreadyBound("External id already bound: " + std::to_string(aExternal));
+        }
+        if (aLocal >= _externals.size()) {
+            _externals.resize(aLocal + 1, noExternalId);
+        }
+        _locals.emplace(aExternal, aLocal);
+        _externals[aLocal] = aExternal;
+    }
+
+    void EntityIndex::unbind(std::size_t aLocal)
+    {
+        const auto external = externalOf(aLocal);
+
+        if (external == noExternalId) {
+            return;
+        }
+        _locals.erase(external);
+        _externals[aLocal] = noExternalId;
+    }
+
+    std::size_t EntityIndex::find(externalId aExternal) const
+    {
+        const auto found = _locals.find(aExternal);
+
+        return found != _locals.end() ? found->second : nullId;
+    }
+
+    EntityIndex::externalId EntityIndex::externalOf(std::size_t aLocal) const
+    {
+        return aLocal < _externals.size() ? _externals[aLocal] : noExternalId;
+    }
+
+    void EntityIndex::remap(std::span<const std::size_t> aRemap)
+    {
+        std::vector<externalId> externals;
+
+        for (std::size_t local = 0; local < _externals.size(); local++) {
+            const auto external = _externals[local];
+            const auto newLocal = local < aRemap.size() ? aRemap[local] : nullId;
+
+            if (external == noExternalId) {
+                continue;
+            }
+            if (newLocal == nullId) {
+                _locals.erase(external);
+                continue;
+            }
+            if (newLocal >= externals.size()) {
+                externals.resize(newLocal + 1, noExternalId);
+            }
+            externals[newLocal] = external;
+            _locals[external] = newLocal;
+        }
+        _externals = std::move(externals);
+    }
+
+    void EntityIndex::shrinkToFit(std::size_t aSize)
+    {
+        auto newSize = _externals.size();
+
+        while (newSize > aSize && _externals[newSize - 1] == noExternalId) {
+            newSize--;
+        }
+        _externals.resize(newSize);
+        _externals.shrink_to_fit();
+        _locals.rehash(0);
+    }
+
+    std::size_t EntityIndex::size() const
+    {
+        return _locals.size();
+    }
+
+    std::size_t EntityIndex::bytesReserved() const
+    {
+        constexpr std::size_t nodeOverhead = 2 * sizeof(void *);
+
+        return _externals.capacity() * sizeof(externalId) + _locals.bucket_count() * sizeof(void *)
+               + _locals.size() * (sizeof(std::pair<const externalId, std::size_t>) + nodeOverhead);
+    }
+} // namespace Engine::Core
@@ -0,0 +1,72 @@
+#include "Events/EventArena.hpp"
+#include <algorithm>
+#include <cstdint>
+
+namespace Engine::Event {
+    EventArena::EventArena(std::size_t aChunkSize)
+        : _chunkSize(std::max<std::size_t>(aChunkSize, 1))
+    {}
+
+    void *EventArena::allocate(std::size_t aSize, std::size_t aAlignment)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        while (_chunk < _chunks.size()) {
+            auto &chunk = _chunks[_chunk];
+            const auto base = reinterpret_cast<std::uintptr_t>(chunk.data.get());
+            const auto aligned = ((base + _offset + aAlignment - 1) & ~(aAlignment - 1)) - base;
+
+            if (aligned + aSize <= chunk.size) {
+                _offset = aligned + aSize;
+                _used += aSize;
+                return chunk.data.get() + aligned;
+            }
+            _chunk++;
+            _offset = 0;
+        }
+        const auto size = std::max(_chunkSize, aSize + aAlignment);
+
+        _chunks.push_back(Chunk {std::make_unique<std::byte[]>(size), size});
+        const auto base = reinterpret_cast<std::uintptr_t>(_chunks.back().data.get());
+        const auto aligned = ((base + aAlignment - 1) & ~(aAlignment - 1)) - base;
+
+        _chunk = _chunks.size() - 1;
+        _offset = aligned + aSize;
+        _used += aSize;
+        return _chunks.back().data.get() + aligned;
+    }
+
+    std::string_view EventArena::store(std::string_view aText)
+    {
+        const auto copy = store(std::span<const char>(aText.data(), aText.size()));
+
+        return std::string_view(copy.data(), copy.size());
+    }
+
+    void EventArena::reset()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _chunk = 0;
+        _offset = 0;
+        _used = 0;
+    }
+
+    std::size_t EventArena::bytesUsed() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        return _used;
+    }
+
+    std::size_t EventArena::bytesReserved() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        std::size_t reserved = 0;
+
+        for (const auto &chunk : _chunks) {
+            reserved += chunk.size;
+        }
+        return reserved;
+    }
+} // namespace Engine::Event
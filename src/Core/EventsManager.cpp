@@ -13,3 +13,19 @@ Engine::Event::EventManager &Engine::Event::EventManager::getInstance()
 
     return instance;
 }
+
+std::size_t Engine::Event::EventManager::getEventCount()
+{
+    std::size_t count = 0;
+    std::shared_lock lock(_handlersMutex);
+
+    for (auto &handler : _eventsHandler) {
+        count += std::get<1>(handler.second->second)(handler.second->first);
+    }
+    return count;
+}
+
+Engine::Event::EventArena &Engine::Event::EventManager::getArena()
+{
+    return _arena;
+}
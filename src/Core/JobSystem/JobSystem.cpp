@@ -0,0 +1,207 @@
+#include "JobSystem.hpp"
+#include <chrono>
+
+namespace Engine::Core {
+    namespace {
+        constexpr std::size_t notAWorker = static_cast<std::size_t>(-1);
+        constexpr auto idleTimeout = std::chrono::milliseconds(1);
+
+        thread_local const JobSystem *currentSystem = nullptr;
+        thread_local std::size_t currentWorker = notAWorker;
+    } // namespace
+
+    JobSystem::JobSystem(std::size_t aWorkers)
+    {
+        const auto workers = std::max<std::size_t>(aWorkers, 1);
+
+        for (std::size_t idx = 0; idx < workers; idx++) {
+            _deques.push_back(std::make_unique<WorkStealingDeque<Job *>>());
+        }
+        _workers.reserve(workers);
+        for (std::size_t idx = 0; idx < workers; idx++) {
+            _workers.emplace_back([this, idx]() {
+                work(idx);
+            });
+        }
+    }
+
+    JobSystem::~JobSystem()
+    {
+        _stopping.store(true);
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+        }
+        _wake.notify_all();
+        for (auto &worker : _workers) {
+            worker.join();
+        }
+        for (auto &deque : _deques) {
+            while (auto dropped = deque->pop()) {
+                delete *dropped;
+            }
+        }
+        for (auto *dropped : _injected) {
+            delete dropped;
+        }
+    }
+
+    JobSystem &JobSystem::getInstance()
+    {
+        static JobSystem instance;
+
+        return instance;
+    }
+
+    std::size_t JobSystem::defaultWorkerCount()
+    {
+        const auto hardware = static_cast<std::size_t>(std::thread::hardware_concurrency());
+
+        return hardware > 1 ? hardware - 1 : 1;
+    }
+
+    void JobSystem::submit(job &&aJob, JobCounter &aCounter)
+    {
+        aCounter._pending.fetch_add(1, std::memory_order_relaxed);
+        push(new Job {std::move(aJob), &aCounter});
+    }
+
+    void JobSystem::submitAfter(JobCounter &aDependency, job &&aJob, JobCounter &aCounter)
+    {
+        aCounter._pending.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(aDependency._mutex);
+
+            if (!aDependency.isDone()) {
+                aDependency._continuations.push_back(JobCounter::Continuation {std::move(aJob), &aCounter});
+                return;
+            }
+        }
+        push(new Job {std::move(aJob), &aCounter});
+    }
+
+    void JobSystem::wait(JobCounter &aCounter)
+    {
+        while (!aCounter.isDone()) {
+            if (auto *next = take()) {
+                execute(next);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        std::lock_guard<std::mutex> lock(aCounter._mutex);
+
+        if (aCounter._error) {
+            std::rethrow_exception(std::exchange(aCounter._error, nullptr));
+        }
+    }
+
+    std::size_t JobSystem::size() const
+    {
+        return _workers.size();
+    }
+
+    void JobSystem::push(Job *aJob)
+    {
+        _queued.fetch_add(1, std::memory_order_release);
+        if (currentSystem == this && currentWorker != notAWorker) {
+            _deques[currentWorker]->push(aJob);
+        } else {
+            std::lock_guard<std::mutex> lock(_injectedMutex);
+
+            _injected.push_back(aJob);
+        }
+        if (_sleeping.load(std::memory_order_acquire) > 0) {
+            _wake.notify_one();
+        }
+    }
+
+    JobSystem::Job *JobSystem::take()
+    {
+        const bool isWorker = currentSystem == this && currentWorker != notAWorker;
+
+        if (isWorker) {
+            if (auto own = _deques[currentWorker]->pop()) {
+                _queued.fetch_sub(1, std::memory_order_relaxed);
+                return *own;
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(_injectedMutex);
+
+            if (!_injected.empty()) {
+                auto *injected = _injected.front();
+
+                _injected.pop_front();
+                _queued.fetch_sub(1, std::memory_order_relaxed);
+                return injected;
+            }
+        }
+        const auto start = isWorker ? currentWorker + 1 : 0;
+
+        for (std::size_t idx = 0; idx < _deques.size(); idx++) {
+            const auto victim = (start + idx) % _deques.size();
+
+            if (isWorker && victim == currentWorker) {
+                continue;
+            }
+            if (auto stolen = _deques[victim]->steal()) {
+                _queued.fetch_sub(1, std::memory_order_relaxed);
+                return *stolen;
+            }
+        }
+        return nullptr;
+    }
+
+    void JobSystem::execute(Job *aJob)
+    {
+        auto &counter = *aJob->counter;
+
+        try {
+            aJob->func();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(counter._mutex);
+
+            if (!counter._error) {
+                counter._error = std::current_exception();
+            }
+        }
+        delete aJob;
+        finish(counter);
+    }
+
+    void JobSystem::finish(JobCounter &aCounter)
+    {
+        std::vector<JobCounter::Continuation> continuations;
+
+        {
+            std::lock_guard<std::mutex> lock(aCounter._mutex);
+
+            if (aCounter._pending.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+            continuations.swap(aCounter._continuations);
+        }
+        for (auto &continuation : continuations) {
+            push(new Job {std::move(continuation.job), continuation.counter});
+        }
+    }
+
+    void JobSystem::work(std::size_t aWorker)
+    {
+        currentSystem = this;
+        currentWorker = aWorker;
+        while (!_stopping.load(std::memory_order_acquire)) {
+            if (auto *next = take()) {
+                execute(next);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+
+            _sleeping.fetch_add(1, std::memory_order_acq_rel);
+            _wake.wait_for(lock, idleTimeout, [this]() {
+                return _stopping.load(std::memory_order_acquire) || _queued.load(std::memory_order_acquire) > 0;
+            });
+            _sleeping.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+} // namespace Engine::Core
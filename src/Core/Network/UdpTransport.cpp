@@ -0,0 +1,325 @@
+#include "Network/UdpTransport.hpp"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <spdlog/spdlog.h>
+
+#if defined(__linux__)
+    #include <poll.h>
+    #include <sys/socket.h>
+#endif
+
+namespace Engine::Network {
+    namespace {
+        constexpr int pollTimeoutMs = 10;
+        constexpr unsigned int byteBits = 8;
+        constexpr unsigned int byteMask = 0xff;
+
+#if defined(__linux__)
+        /**
+         * @brief Receive up to a batch of datagrams with one recvmmsg
+         */
+        class BatchReceiver
+        {
+            public:
+                BatchReceiver(std::size_t aBatchSize, std::size_t aMaxDatagramSize)
+                    : _maxDatagramSize(aMaxDatagramSize),
+                      _buffer(aBatchSize * aMaxDatagramSize),
+                      _headers(aBatchSize),
+                      _iovecs(aBatchSize),
+                      _addresses(aBatchSize)
+                {}
+
+                bool wait(boost::asio::ip::udp::socket &aSocket)
+                {
+                    pollfd descriptor {aSocket.native_handle(), POLLIN, 0};
+
+                    return poll(&descriptor, 1, pollTimeoutMs) > 0;
+                }
+
+                std::size_t receive(boost::asio::ip::udp::socket &aSocket)
+                {
+                    for (std::size_t idx = 0; idx < _headers.size(); idx++) {
+                        _iovecs[idx] = iovec {_buffer.data() + idx * _maxDatagramSize, _maxDatagramSize};
+                        _headers[idx] = mmsghdr {};
+                        _headers[idx].msg_hdr.msg_name = &_addresses[idx];
+                        _headers[idx].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+                        _headers[idx].msg_hdr.msg_iov = &_iovecs[idx];
+                        _headers[idx].msg_hdr.msg_iovlen = 1;
+                    }
+                    const auto count = recvmmsg(aSocket.native_handle(), _headers.data(),
+                                                static_cast<unsigned int>(_headers.size()), MSG_DONTWAIT, nullptr);
+
+                    return count < 0 ? 0 : static_cast<std::size_t>(count);
+                }
+
+                [[nodiscard]] const std::byte *data(std::size_t aIdx) const
+                {
+                    return _buffer.data() + aIdx * _maxDatagramSize;
+                }
+
+                [[nodiscard]] std::size_t size(std::size_t aIdx) const
+                {
+                    return _headers[aIdx].msg_len;
+                }
+
+                [[nodiscard]] bool truncated(std::size_t aIdx) const
+                {
+                    return (_headers[aIdx].msg_hdr.msg_flags & MSG_TRUNC) != 0;
+                }
+
+                [[nodiscard]] boost::asio::ip::udp::endpoint from(std::size_t aIdx) const
+                {
+                    boost::asio::ip::udp::endpoint sender;
+
+                    std::memcpy(sender.data(), &_addresses[aIdx], _headers[aIdx].msg_hdr.msg_namelen);
+                    sender.resize(_headers[aIdx].msg_hdr.msg_namelen);
+                    return sender;
+                }
+
+            private:
+                std::size_t _maxDatagramSize;
+                std::vector<std::byte> _buffer;
+                std::vector<mmsghdr> _headers;
+                std::vector<iovec> _iovecs;
+                std::vector<sockaddr_storage> _addresses;
+        };
+#else
+        /**
+         * @brief Receive up to a batch of datagrams, one receive_from each
+         */
+        class BatchReceiver
+        {
+            public:
+                BatchReceiver(std::size_t aBatchSize, std::size_t aMaxDatagramSize)
+                    : _maxDatagramSize(aMaxDatagramSize),
+                      _buffer(aBatchSize * aMaxDatagramSize),
+                      _sizes(aBatchSize),
+                      _truncated(aBatchSize),
+                      _senders(aBatchSize)
+                {}
+
+                bool wait(boost::asio::ip::udp::socket &aSocket)
+                {
+                    boost::system::error_code error;
+
+                    if (aSocket.available(error) > 0) {
+                        return true;
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    return false;
+                }
+
+                std::size_t receive(boost::asio::ip::udp::socket &aSocket)
+                {
+                    boost::system::error_code error;
+                    std::size_t count = 0;
+
+                    while (count < _sizes.size() && aSocket.available(error) > 0) {
+                        _sizes[count] = aSocket.receive_from(
+                            boost::asio::buffer(_buffer.data() + count * _maxDatagramSize, _maxDatagramSize),
+                            _senders[count], 0, error);
+                        _truncated[count] = error == boost::asio::error::message_size;
+                        if (error && !_truncated[count]) {
+                            break;
+                        }
+                        count++;
+                    }
+                    return count;
+                }
+
+                [[nodiscard]] const std::byte *data(std::size_t aIdx) const
+                {
+                    return _buffer.data() + aIdx * _maxDatagramSize;
+                }
+
+                [[nodiscard]] std::size_t size(std::size_t aIdx) const
+                {
+                    return _sizes[aIdx];
+                }
+
+                [[nodiscard]] bool truncated(std::size_t aIdx) const
+                {
+                    return _truncated[aIdx];
+                }
+
+                [[nodiscard]] boost::asio::ip::udp::endpoint from(std::size_t aIdx) const
+                {
+                    return _senders[aIdx];
+                }
+
+            private:
+                std::size_t _maxDatagramSize;
+                std::vector<std::byte> _buffer;
+                std::vector<std::size_t> _sizes;
+                std::vector<bool> _truncated;
+                std::vector<boost::asio::ip::udp::endpoint> _senders;
+        };
+#endif
+    } // namespace
+
+    UdpTransport::UdpTransport(const endpoint &aLocal, std::size_t aBatchSize, std::size_t aMaxDatagramSize,
+                               std::size_t aMaxPendingPackets)
+        : _socket(_context, aLocal),
+          _batchSize(std::max<std::size_t>(aBatchSize, 1)),
+          _maxDatagramSize(std::max(aMaxDatagramSize, headerSize)),
+          _maxPendingPackets(aMaxPendingPackets)
+    {
+        _receiver = std::thread([this]() {
+            receiveLoop();
+        });
+        spdlog::debug("UDP transport listening on port {}", _socket.local_endpoint().port());
+    }
+
+    UdpTransport::~UdpTransport()
+    {
+        boost::system::error_code error;
+
+        _running = false;
+        if (_receiver.joinable()) {
+            _receiver.join();
+        }
+        _socket.close(error);
+    }
+
+    UdpTransport::endpoint UdpTransport::localEndpoint() const
+    {
+        return _socket.local_endpoint();
+    }
+
+    void UdpTransport::sendRaw(const endpoint &aTo, messageId aId, std::span<const std::byte> aPayload)
+    {
+        const auto size = headerSize + aPayload.size();
+
+        if (size > _maxDatagramSize) {
+            throw UdpTransportExceptionMessageTooLarge("Message too large: " + std::to_string(size));
+        }
+        _outgoing.packets.push_back(Packet {_outgoing.bytes.size(), size, aTo});
+        _outgoing.bytes.push_back(static_cast<std::byte>(aId & byteMask));
+        _outgoing.bytes.push_back(static_cast<std::byte>(aId >> byteBits));
+        _outgoing.bytes.insert(_outgoing.bytes.end(), aPayload.begin(), aPayload.end());
+    }
+
+    void UdpTransport::flush()
+    {
+        const auto &packets = _outgoing.packets;
+
+#if defined(__linux__)
+        std::vector<mmsghdr> headers(std::min(_batchSize, packets.size()));
+        std::vector<iovec> iovecs(headers.size());
+
+        for (std::size_t first = 0; first < packets.size();) {
+            const auto count = std::min(headers.size(), packets.size() - first);
+
+            for (std::size_t idx = 0; idx < count; idx++) {
+                const auto &packet = packets[first + idx];
+
+                iovecs[idx] = iovec {_outgoing.bytes.data() + packet.offset, packet.size};
+                headers[idx] = mmsghdr {};
+                headers[idx].msg_hdr.msg_name = const_cast<sockaddr *>(packet.peer.data());
+                headers[idx].msg_hdr.msg_namelen = static_cast<socklen_t>(packet.peer.size());
+                headers[idx].msg_hdr.msg_iov = &iovecs[idx];
+                headers[idx].msg_hdr.msg_iovlen = 1;
+            }
+            const auto sent = sendmmsg(_socket.native_handle(), headers.data(), static_cast<unsigned int>(count), 0);
+
+            if (sent <= 0) {
+                _current.packetsDropped++;
+                first++;
+                continue;
+            }
+            for (std::size_t idx = 0; idx < static_cast<std::size_t>(sent); idx++) {
+                _current.packetsSent++;
+                _current.bytesSent += packets[first + idx].size;
+            }
+            first += static_cast<std::size_t>(sent);
+        }
+#else
+        for (const auto &packet : packets) {
+            boost::system::error_code error;
+
+            _socket.send_to(boost::asio::buffer(_outgoing.bytes.data() + packet.offset, packet.size), packet.peer, 0,
+                            error);
+            if (error) {
+                _current.packetsDropped++;
+                continue;
+            }
+            _current.packetsSent++;
+            _current.bytesSent += packet.size;
+        }
+#endif
+        _outgoing.clear();
+    }
+
+    std::size_t UdpTransport::dispatch()
+    {
+        std::size_t pushed = 0;
+        std::size_t dropped = _dropped.exchange(0);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            std::swap(_received, _dispatched);
+        }
+        for (const auto &packet : _dispatched.packets) {
+            const auto *bytes = _dispatched.bytes.data() + packet.offset;
+
+            _current.packetsReceived++;
+            _current.bytesReceived += packet.size;
+            if (packet.size < headerSize) {
+                dropped++;
+                continue;
+            }
+            const auto id = static_cast<messageId>(std::to_integer<unsigned int>(bytes[0])
+                                                   | (std::to_integer<unsigned int>(bytes[1]) << byteBits));
+            auto found = _messages.find(id);
+
+            if (found == _messages.end()
+                || !std::get<0>(found->second.second)(
+                    found->second.first, std::span<const std::byte>(bytes + headerSize, packet.size - headerSize),
+                    packet.peer)) {
+                dropped++;
+            }
+        }
+        for (auto &registered : _messages) {
+            pushed += std::get<1>(registered.second.second)(registered.second.first);
+        }
+        _dispatched.clear();
+        _current.packetsDropped += dropped;
+        _tickStats = _current;
+        _current = TransportStats {};
+        return pushed;
+    }
+
+    const TransportStats &UdpTransport::getTickStats() const
+    {
+        return _tickStats;
+    }
+
+    void UdpTransport::receiveLoop()
+    {
+        BatchReceiver receiver(_batchSize, _maxDatagramSize);
+
+        while (_running) {
+            if (!receiver.wait(_socket)) {
+                continue;
+            }
+            const auto count = receiver.receive(_socket);
+
+            if (count == 0) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            for (std::size_t idx = 0; idx < count; idx++) {
+                if (receiver.truncated(idx) || _received.packets.size() >= _maxPendingPackets) {
+                    _dropped++;
+                    continue;
+                }
+                _received.packets.push_back(Packet {_received.bytes.size(), receiver.size(idx), receiver.from(idx)});
+                _received.bytes.insert(_received.bytes.end(), receiver.data(idx),
+                                       receiver.data(idx) + receiver.size(idx));
+            }
+        }
+    }
+} // namespace Engine::Network
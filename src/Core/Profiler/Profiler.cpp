@@ -0,0 +1,205 @@
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace Engine {
+    namespace {
+        constexpr double microsecondsPerMillisecond = 1000.0;
+        constexpr double percentile50 = 0.50;
+        constexpr double percentile95 = 0.95;
+        constexpr double percentile99 = 0.99;
+
+        void writeJsonString(std::ostream &aStream, const std::string &aString)
+        {
+            constexpr char lastControlChar = 0x1f;
+
+            aStream << '"';
+            for (const char chr : aString) {
+                if (chr == '"' || chr == '\\') {
+                    aStream << '\\' << chr;
+                } else if (chr >= 0 && chr <= lastControlChar) {
+                    aStream << ' ';
+                } else {
+                    aStream << chr;
+                }
+            }
+            aStream << '"';
+        }
+
+        double percentile(const std::vector<double> &aSorted, double aRank)
+        {
+            const auto last = static_cast<double>(aSorted.size() - 1);
+
+            return aSorted[static_cast<std::size_t>(std::round(last * aRank))];
+        }
+    } // namespace
+
+    void Profiler::beginFrame()
+    {
+        _frameStart = clock::now();
+    }
+
+    void Profiler::endFrame()
+    {
+        const auto frameEnd = clock::now();
+        const double duration = toMicroseconds(frameEnd) - toMicroseconds(_frameStart);
+
+        pushSample(_frames, duration / microsecondsPerMillisecond);
+        pushTrace(TraceEvent {frameName, 'X', toMicroseconds(_frameStart), duration, 0});
+    }
+
+    Profiler::nameId Profiler::internName(const std::string &aName)
+    {
+        const auto found = _nameIds.find(aName);
+
+        if (found != _nameIds.end()) {
+            return found->second;
+        }
+        const nameId id = _names.size();
+
+        _names.push_back(aName);
+        _nameIds.emplace(aName, id);
+        _systems.emplace_back();
+        return id;
+    }
+
+    const std::string &Profiler::getName(nameId aName) const
+    {
+        return _names.at(aName);
+    }
+
+    void Profiler::recordSystem(nameId aName, timePoint aStart, timePoint aEnd, std::size_t aEntities)
+    {
+        const double duration = toMicroseconds(aEnd) - toMicroseconds(aStart);
+
+        pushSample(_systems[aName], duration / microsecondsPerMillisecond);
+        pushTrace(TraceEvent {aName, 'X', toMicroseconds(aStart), duration, aEntities});
+    }
+
+    void Profiler::recordSystem(const std::string &aName, timePoint aStart, timePoint aEnd, std::size_t aEntities)
+    {
+        recordSystem(internName(aName), aStart, aEnd, aEntities);
+    }
+
+    void Profiler::recordCounter(nameId aName, std::size_t aValue)
+    {
+        pushTrace(TraceEvent {aName, 'C', toMicroseconds(clock::now()), 0, aValue});
+    }
+
+    void Profiler::recordCounter(const std::string &aName, std::size_t aValue)
+    {
+        recordCounter(internName(aName), aValue);
+    }
+
+    Profiler::Stats Profiler::getFrameStats() const
+    {
+        return computeStats(_frames);
+    }
+
+    Profiler::Stats Profiler::getSystemStats(const std::string &aName) const
+    {
+        const auto found = _nameIds.find(aName);
+
+        if (found == _nameIds.end()) {
+            return Stats {};
+        }
+        return computeStats(_systems[found->second]);
+    }
+
+    const std::deque<Profiler::TraceEvent> &Profiler::getTrace() const
+    {
+        return _trace;
+    }
+
+    void Profiler::exportChromeTrace(std::ostream &aStream) const
+    {
+        bool first = true;
+
+        aStream << R"({"displayTimeUnit":"ms","traceEvents":[)";
+        for (const auto &event : _trace) {
+            aStream << (first ? "" : ",") << R"({"name":)";
+            writeJsonString(aStream, _names[event.name]);
+            aStream << R"(,"ph":")" << event.phase << R"(","pid":1,"tid":1,"ts":)" << event.timestamp;
+            if (event.phase == 'X') {
+                aStream << R"(,"dur":)" << event.duration << R"(,"cat":")"
+                        << (event.name == frameName ? "frame" : "system") << R"(","args":{"entities":)" << event.value
+                        << "}}";
+            } else {
+                aStream << R"(,"args":{"value":)" << event.value << "}}";
+            }
+            first = false;
+        }
+        aStream << "]}";
+    }
+
+    void Profiler::setWindowSize(std::size_t aWindowSize)
+    {
+        _windowSize = std::max<std::size_t>(aWindowSize, 1);
+        while (_frames.size() > _windowSize) {
+            _frames.pop_front();
+        }
+        for (auto &system : _systems) {
+            while (system.size() > _windowSize) {
+                system.pop_front();
+            }
+        }
+    }
+
+    void Profiler::setMaxTraceEvents(std::size_t aMaxTraceEvents)
+    {
+        _maxTraceEvents = aMaxTraceEvents;
+        while (_trace.size() > _maxTraceEvents) {
+            _trace.pop_front();
+        }
+    }
+
+    void Profiler::clear()
+    {
+        _frames.clear();
+        for (auto &system : _systems) {
+            system.clear();
+        }
+        _trace.clear();
+    }
+
+    double Profiler::toMicroseconds(timePoint aTime) const
+    {
+        return std::chrono::duration<double, std::micro>(aTime - _epoch).count();
+    }
+
+    void Profiler::pushSample(std::deque<double> &aWindow, double aMilliseconds) const
+    {
+        aWindow.push_back(aMilliseconds);
+        if (aWindow.size() > _windowSize) {
+            aWindow.pop_front();
+        }
+    }
+
+    void Profiler::pushTrace(TraceEvent &&aEvent)
+    {
+        if (_maxTraceEvents == 0) {
+            return;
+        }
+        _trace.push_back(std::move(aEvent));
+        if (_trace.size() > _maxTraceEvents) {
+            _trace.pop_front();
+        }
+    }
+
+    Profiler::Stats Profiler::computeStats(const std::deque<double> &aWindow)
+    {
+        if (aWindow.empty()) {
+            return Stats {};
+        }
+        std::vector<double> sorted(aWindow.begin(), aWindow.end());
+
+        std::sort(sorted.begin(), sorted.end());
+        return Stats {sorted.size(),
+                      std::accumulate(sorted.begin(), sorted.end(), 0.0) / static_cast<double>(sorted.size()),
+                      percentile(sorted, percentile50),
+                      percentile(sorted, percentile95),
+                      percentile(sorted, percentile99),
+                      sorted.back()};
+    }
+} // namespace Engine
@@ -0,0 +1,234 @@
+#include "Script.hpp"
+#include <algorithm>
+#include <array>
+#include <new>
+
+namespace Engine::Core {
+    namespace {
+        constexpr std::size_t sizeClasses = ScriptFramePool::maxPooledSize / ScriptFramePool::granularity;
+
+        struct FreeLists
+        {
+                std::array<std::vector<void *>, sizeClasses> frames;
+
+                FreeLists() = default;
+
+                ~FreeLists()
+                {
+                    for (auto &sizeClass : frames) {
+                        for (auto *frame : sizeClass) {
+                            ::operator delete(frame);
+                        }
+                    }
+                }
+
+                FreeLists(const FreeLists &other) = delete;
+                FreeLists &operator=(const FreeLists &other) = delete;
+
+                FreeLists(FreeLists &&other) noexcept = delete;
+                FreeLists &operator=(FreeLists &&other) noexcept = delete;
+        };
+
+        FreeLists &freeLists()
+        {
+            thread_local FreeLists lists;
+
+            return lists;
+        }
+
+        std::size_t sizeClassOf(std::size_t aSize)
+        {
+            return (aSize + ScriptFramePool::granularity - 1) / ScriptFramePool::granularity - 1;
+        }
+    } // namespace
+
+    void *ScriptFramePool::allocate(std::size_t aSize)
+    {
+        if (aSize == 0 || aSize > maxPooledSize) {
+            return ::operator new(aSize);
+        }
+        auto &sizeClass = freeLists().frames[sizeClassOf(aSize)];
+
+        if (sizeClass.empty()) {
+            return ::operator new((sizeClassOf(aSize) + 1) * granularity);
+        }
+        auto *frame = sizeClass.back();
+
+        sizeClass.pop_back();
+        return frame;
+    }
+
+    void ScriptFramePool::deallocate(void *aFrame, std::size_t aSize) noexcept
+    {
+        if (aSize == 0 || aSize > maxPooledSize) {
+            ::operator delete(aFrame);
+            return;
+        }
+        try {
+            freeLists().frames[sizeClassOf(aSize)].push_back(aFrame);
+        } catch (const std::bad_alloc & /*unused*/) {
+            ::operator delete(aFrame);
+        }
+    }
+
+    ScriptScheduler::~ScriptScheduler()
+    {
+        for (auto script : _nextFrame) {
+            script.destroy();
+        }
+        while (!_timers.empty()) {
+            _timers.top().script.destroy();
+            _timers.pop();
+        }
+        for (auto &queue : _events) {
+            for (auto &waiter : queue.second.waiters) {
+                waiter.script.destroy();
+            }
+        }
+    }
+
+    void ScriptScheduler::start(Script &&aScript)
+    {
+        start(Script::noEntity, std::move(aScript));
+    }
+
+    void ScriptScheduler::start(std::size_t aEntity, Script &&aScript)
+    {
+        auto script = aScript.release();
+
+        if (!script) {
+            return;
+        }
+        script.promise().scheduler = this;
+        script.promise().entity = aEntity;
+        if (aEntity != Script::noEntity) {
+            _entityScripts.emplace(aEntity, script);
+        }
+        _scripts++;
+        if (auto error = resume(script)) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void ScriptScheduler::cancel(std::size_t aEntity)
+    {
+        const auto [first, last] = _entityScripts.equal_range(aEntity);
+
+        for (auto script = first; script != last; script++) {
+            script->second.promise().cancelled = true;
+        }
+        _entityScripts.erase(first, last);
+    }
+
+    void ScriptScheduler::remap(std::span<const std::size_t> aRemap)
+    {
+        boost::container::flat_multimap<std::size_t, handle> remapped;
+
+        for (const auto &[entity, script] : _entityScripts) {
+            const auto newEntity = entity < aRemap.size() ? aRemap[entity] : Script::noEntity;
+
+            if (newEntity == Script::noEntity) {
+                script.promise().cancelled = true;
+                continue;
+            }
+            script.promise().entity = newEntity;
+            remapped.emplace(newEntity, script);
+        }
+        _entityScripts = std::move(remapped);
+    }
+
+    void ScriptScheduler::update(double aDeltaTime)
+    {
+        std::exception_ptr firstError;
+        auto resumeAll = [this, &firstError](const std::vector<handle> &aScripts) {
+            for (auto script : aScripts) {
+                auto error = resume(script);
+
+                if (error && !firstError) {
+                    firstError = error;
+                }
+            }
+        };
+
+        _time += aDeltaTime;
+        resumeAll(std::exchange(_nextFrame, {}));
+
+        std::vector<handle> due;
+
+        while (!_timers.empty() && _timers.top().wakeTime <= _time) {
+            due.push_back(_timers.top().script);
+            _timers.pop();
+        }
+        resumeAll(due);
+
+        due.clear();
+        for (auto &queue : _events) {
+            if (queue.second.waiters.empty()) {
+                continue;
+            }
+            const auto count = queue.second.count();
+
+            std::erase_if(queue.second.waiters, [count, &due](EventWaiter &aWaiter) {
+                if (count < aWaiter.seen) {
+                    aWaiter.seen = 0;
+                }
+                if (count == aWaiter.seen) {
+                    return false;
+                }
+                aWaiter.deliver(aWaiter.seen);
+                due.push_back(aWaiter.script);
+                return true;
+            });
+        }
+        resumeAll(due);
+        if (firstError) {
+            std::rethrow_exception(firstError);
+        }
+    }
+
+    std::size_t ScriptScheduler::size() const
+    {
+        return _scripts;
+    }
+
+    double ScriptScheduler::getTime() const
+    {
+        return _time;
+    }
+
+    void ScriptScheduler::waitNextFrame(handle aScript)
+    {
+        _nextFrame.push_back(aScript);
+    }
+
+    void ScriptScheduler::waitSeconds(handle aScript, double aDuration)
+    {
+        _timers.push(Timer {_time + aDuration, _timerOrder++, aScript});
+    }
+
+    std::exception_ptr ScriptScheduler::resume(handle aScript)
+    {
+        if (!aScript.promise().cancelled) {
+            aScript.resume();
+            if (!aScript.done()) {
+                return nullptr;
+            }
+        }
+        auto &promise = aScript.promise();
+        auto error = promise.error;
+
+        if (promise.entity != Script::noEntity && !promise.cancelled) {
+            const auto [first, last] = _entityScripts.equal_range(promise.entity);
+            const auto found = std::find_if(first, last, [aScript](const auto &aPair) {
+                return aPair.second == aScript;
+            });
+
+            if (found != last) {
+                _entityScripts.erase(found);
+            }
+        }
+        aScript.destroy();
+        _scripts--;
+        return error;
+    }
+} // namespace Engine::Core
@@ -0,0 +1,146 @@
+#include "Simd.hpp"
+#include <algorithm>
+#include <cstddef>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #define ENGINE_SIMD_AVX2
+    #include <immintrin.h>
+#elif defined(__ARM_NEON)
+    #define ENGINE_SIMD_NEON
+    #include <arm_neon.h>
+#endif
+
+namespace Engine::Simd {
+    namespace Scalar {
+        void integrate(std::span<float> aValues, std::span<const float> aRates, float aDelta)
+        {
+            const std::size_t count = std::min(aValues.size(), aRates.size());
+
+            for (std::size_t idx = 0; idx < count; idx++) {
+                aValues[idx] += aRates[idx] * aDelta;
+            }
+        }
+
+        void scale(std::span<float> aValues, float aFactor)
+        {
+            for (auto &value : aValues) {
+                value *= aFactor;
+            }
+        }
+    } // namespace Scalar
+
+#ifdef ENGINE_SIMD_AVX2
+    namespace {
+        constexpr std::size_t avxWidth = 8;
+
+        bool hasAvx2()
+        {
+            static const bool supported = __builtin_cpu_supports("avx2") != 0;
+
+            return supported;
+        }
+
+        __attribute__((target("avx2"))) void integrateAvx2(std::span<float> aValues, std::span<const float> aRates,
+                                                           float aDelta)
+        {
+            const std::size_t count = std::min(aValues.size(), aRates.size());
+            const std::size_t vectorized = count - count % avxWidth;
+            const __m256 delta = _mm256_set1_ps(aDelta);
+            std::size_t idx = 0;
+
+            for (; idx < vectorized; idx += avxWidth) {
+                const __m256 values = _mm256_loadu_ps(aValues.data() + idx);
+                const __m256 rates = _mm256_loadu_ps(aRates.data() + idx);
+
+                _mm256_storeu_ps(aValues.data() + idx, _mm256_add_ps(values, _mm256_mul_ps(rates, delta)));
+            }
+            Scalar::integrate(aValues.subspan(idx, count - idx), aRates.subspan(idx, count - idx), aDelta);
+        }
+
+        __attribute__((target("avx2"))) void scaleAvx2(std::span<float> aValues, float aFactor)
+        {
+            const std::size_t vectorized = aValues.size() - aValues.size() % avxWidth;
+            const __m256 factor = _mm256_set1_ps(aFactor);
+            std::size_t idx = 0;
+
+            for (; idx < vectorized; idx += avxWidth) {
+                _mm256_storeu_ps(aValues.data() + idx, _mm256_mul_ps(_mm256_loadu_ps(aValues.data() + idx), factor));
+            }
+            Scalar::scale(aValues.subspan(idx), aFactor);
+        }
+    } // namespace
+
+    const char *backendName()
+    {
+        return hasAvx2() ? "avx2" : "scalar";
+    }
+
+    void integrate(std::span<float> aValues, std::span<const float> aRates, float aDelta)
+    {
+        if (hasAvx2()) {
+            integrateAvx2(aValues, aRates, aDelta);
+            return;
+        }
+        Scalar::integrate(aValues, aRates, aDelta);
+    }
+
+    void scale(std::span<float> aValues, float aFactor)
+    {
+        if (hasAvx2()) {
+            scaleAvx2(aValues, aFactor);
+            return;
+        }
+        Scalar::scale(aValues, aFactor);
+    }
+#elif defined(ENGINE_SIMD_NEON)
+    namespace {
+        constexpr std::size_t neonWidth = 4;
+    } // namespace
+
+    const char *backendName()
+    {
+        return "neon";
+    }
+
+    void integrate(std::span<float> aValues, std::span<const float> aRates, float aDelta)
+    {
+        const std::size_t count = std::min(aValues.size(), aRates.size());
+        const std::size_t vectorized = count - count % neonWidth;
+        std::size_t idx = 0;
+
+        for (; idx < vectorized; idx += neonWidth) {
+            const float32x4_t values = vld1q_f32(aValues.data() + idx);
+            const float32x4_t rates = vld1q_f32(aRates.data() + idx);
+
+            vst1q_f32(aValues.data() + idx, vmlaq_n_f32(values, rates, aDelta));
+        }
+        Scalar::integrate(aValues.subspan(idx, count - idx), aRates.subspan(idx, count - idx), aDelta);
+    }
+
+    void scale(std::span<float> aValues, float aFactor)
+    {
+        const std::size_t vectorized = aValues.size() - aValues.size() % neonWidth;
+        std::size_t idx = 0;
+
+        for (; idx < vectorized; idx += neonWidth) {
+            vst1q_f32(aValues.data() + idx, vmulq_n_f32(vld1q_f32(aValues.data() + idx), aFactor));
+        }
+        Scalar::scale(aValues.subspan(idx), aFactor);
+    }
+#else
+    const char *backendName()
+    {
+        return "scalar";
+    }
+
+    void integrate(std::span<float> aValues, std::span<const float> aRates, float aDelta)
+    {
+        Scalar::integrate(aValues, aRates, aDelta);
+    }
+
+    void scale(std::span<float> aValues, float aFactor)
+    {
+        Scalar::scale(aValues, aFactor);
+    }
+#endif
+} // namespace Engine::Simd
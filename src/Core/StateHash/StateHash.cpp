@@ -0,0 +1,132 @@
+#include "StateHash.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace Engine::Core {
+    namespace {
+        constexpr std::uint64_t fnvOffsetBasis = 0xcbf29ce484222325ULL;
+        constexpr std::uint64_t fnvPrime = 0x100000001b3ULL;
+    } // namespace
+
+    std::uint64_t hashBytes(const void *aData, std::size_t aSize)
+    {
+        const auto *bytes = static_cast<const unsigned char *>(aData);
+        std::uint64_t hash = fnvOffsetBasis;
+
+        for (std::size_t idx = 0; idx < aSize; idx++) {
+            hash ^= bytes[idx];
+            hash *= fnvPrime;
+        }
+        return hash;
+    }
+
+    std::uint64_t mixHash(std::uint64_t aValue)
+    {
+        constexpr std::uint64_t firstMultiplier = 0xbf58476d1ce4e5b9ULL;
+        constexpr std::uint64_t secondMultiplier = 0x94d049bb133111ebULL;
+        constexpr int firstShift = 30;
+        constexpr int secondShift = 27;
+        constexpr int thirdShift = 31;
+
+        aValue = (aValue ^ (aValue >> firstShift)) * firstMultiplier;
+        aValue = (aValue ^ (aValue >> secondShift)) * secondMultiplier;
+        return aValue ^ (aValue >> thirdShift);
+    }
+
+    std::size_t findDivergence(std::span<const std::uint64_t> aFirst, std::span<const std::uint64_t> aSecond)
+    {
+        const auto size = std::max(aFirst.size(), aSecond.size());
+
+        for (std::size_t idx = 0; idx < size; idx++) {
+            const auto first = idx < aFirst.size() ? aFirst[idx] : 0;
+            const auto second = idx < aSecond.size() ? aSecond[idx] : 0;
+
+            if (first != second) {
+                return idx;
+            }
+        }
+        return std::numeric_limits<std::size_t>::max();
+    }
+
+    void StateHash::track(slotFunc aSlot, std::size_t aSize)
+    {
+        _slot = std::move(aSlot);
+        _slots.clear();
+        _written.clear();
+        _dirty.clear();
+        _dirtyCount = 0;
+        _digest = 0;
+        markAll(aSize);
+    }
+
+    bool StateHash::isTracked() const
+    {
+        return static_cast<bool>(_slot);
+    }
+
+    void StateHash::reserve(std::size_t aSize)
+    {
+        if (aSize > _written.size()) {
+            _written.resize(aSize, 0);
+            _dirty.resize(aSize, 0);
+            _slots.resize(aSize, 0);
+        }
+    }
+
+    void StateHash::markAll(std::size_t aSize)
+    {
+        reserve(aSize);
+        for (std::size_t idx = 0; idx < _written.size(); idx++) {
+            if (_written[idx] == 0) {
+                _written[idx] = 1;
+                _dirty[_dirtyCount++] = idx;
+            }
+        }
+    }
+
+    void StateHash::flush(const World &aWorld)
+    {
+        for (std::size_t pos = 0; pos < _dirtyCount; pos++) {
+            const auto idx = _dirty[pos];
+            const auto hash = _slot(aWorld, idx);
+
+            _digest += hash - _slots[idx];
+            _slots[idx] = hash;
+            _written[idx] = 0;
+        }
+        _dirtyCount = 0;
+    }
+
+    void StateHash::shrinkToFit(std::size_t aSize)
+    {
+        for (std::size_t idx = aSize; idx < _slots.size(); idx++) {
+            _digest -= _slots[idx];
+        }
+        if (_slots.size() > aSize) {
+            std::size_t kept = 0;
+
+            for (std::size_t pos = 0; pos < _dirtyCount; pos++) {
+                if (_dirty[pos] < aSize) {
+                    _dirty[kept++] = _dirty[pos];
+                }
+            }
+            _dirtyCount = kept;
+            _slots.resize(aSize);
+            _written.resize(aSize);
+            _dirty.resize(aSize);
+        }
+        _slots.shrink_to_fit();
+        _written.shrink_to_fit();
+        _dirty.shrink_to_fit();
+    }
+
+    std::uint64_t StateHash::digest() const
+    {
+        return _digest;
+    }
+
+    std::span<const std::uint64_t> StateHash::slotHashes() const
+    {
+        return std::span<const std::uint64_t>(_slots);
+    }
+} // namespace Engine::Core
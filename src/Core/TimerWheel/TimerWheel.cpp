@@ -0,0 +1,223 @@
+#include "TimerWheel.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace Engine::Core {
+    namespace {
+        constexpr std::size_t generationShift = 32;
+        constexpr TimerWheel::tick lowerBitsMask = 0xffffffffULL;
+    } // namespace
+
+    TimerWheel::timerId TimerWheel::add(tick aDelay, timerFunc aFunc, std::size_t aOwner)
+    {
+        std::uint32_t idx = 0;
+
+        if (_free.empty()) {
+            idx = static_cast<std::uint32_t>(_nodes.size());
+            _nodes.emplace_back();
+        } else {
+            idx = _free.back();
+            _free.pop_back();
+        }
+        auto &node = _nodes[idx];
+
+        node.due = _now + std::max<tick>(aDelay, 1);
+        node.func = std::move(aFunc);
+        node.owner = aOwner;
+        if (aOwner != noOwner) {
+            if (aOwner >= _owners.size()) {
+                _owners.resize(aOwner + 1, npos);
+            }
+            node.ownerPrev = npos;
+            node.ownerNext = _owners[aOwner];
+            if (node.ownerNext != npos) {
+                _nodes[node.ownerNext].ownerPrev = idx;
+            }
+            _owners[aOwner] = idx;
+        }
+        place(idx);
+        _size++;
+        return (static_cast<timerId>(node.generation) << generationShift) | idx;
+    }
+
+    bool TimerWheel::cancel(timerId aTimer)
+    {
+        if (!isPending(aTimer)) {
+            return false;
+        }
+        release(static_cast<std::uint32_t>(aTimer & lowerBitsMask));
+        return true;
+    }
+
+    std::size_t TimerWheel::cancelOwner(std::size_t aOwner)
+    {
+        std::size_t count = 0;
+
+        while (aOwner < _owners.size() && _owners[aOwner] != npos) {
+            release(_owners[aOwner]);
+            count++;
+        }
+        return count;
+    }
+
+    void TimerWheel::remapOwners(std::span<const std::size_t> aRemap)
+    {
+        std::vector<std::uint32_t> owners;
+
+        for (std::size_t owner = 0; owner < _owners.size(); owner++) {
+            const auto head = _owners[owner];
+            const auto newOwner = owner < aRemap.size() ? aRemap[owner] : noOwner;
+
+            if (head == npos) {
+                continue;
+            }
+            if (newOwner == noOwner) {
+                cancelOwner(owner);
+                continue;
+            }
+            if (newOwner >= owners.size()) {
+                owners.resize(newOwner + 1, npos);
+            }
+            owners[newOwner] = head;
+            for (auto node = head; node != npos; node = _nodes[node].ownerNext) {
+                _nodes[node].owner = newOwner;
+            }
+        }
+        _owners = std::move(owners);
+    }
+
+    bool TimerWheel::isPending(timerId aTimer) const
+    {
+        const auto idx = aTimer & lowerBitsMask;
+
+        return idx < _nodes.size() && _nodes[idx].generation == (aTimer >> generationShift)
+               && _nodes[idx].list != npos;
+    }
+
+    std::size_t TimerWheel::advance(World &aWorld, tick aTicks)
+    {
+        constexpr tick slotMask = slotCount - 1;
+        std::size_t fired = 0;
+
+        for (tick step = 0; step < aTicks; step++) {
+            _now++;
+            if ((_now & slotMask) == 0) {
+                if ((_now & lowerBitsMask) == 0) {
+                    cascade(overflowList);
+                }
+                for (std::size_t wheel = wheelCount - 1; wheel > 0; wheel--) {
+                    if ((_now & ((tick {1} << (slotBits * wheel)) - 1)) == 0) {
+                        cascade(wheel * slotCount + ((_now >> (slotBits * wheel)) & slotMask));
+                    }
+                }
+            }
+            const auto slot = _now & slotMask;
+
+            for (auto node = _heads[slot]; node != npos; node = _nodes[node].next) {
+                _nodes[node].list = firingList;
+            }
+            _heads[firingList] = std::exchange(_heads[slot], npos);
+            while (_heads[firingList] != npos) {
+                const auto node = _heads[firingList];
+                auto func = std::move(_nodes[node].func);
+
+                release(node);
+                func(aWorld);
+                fired++;
+            }
+        }
+        return fired;
+    }
+
+    TimerWheel::tick TimerWheel::now() const
+    {
+        return _now;
+    }
+
+    std::size_t TimerWheel::size() const
+    {
+        return _size;
+    }
+
+    void TimerWheel::place(std::uint32_t aNode)
+    {
+        const auto due = _nodes[aNode].due;
+
+        for (std::size_t wheel = 0; wheel < wheelCount; wheel++) {
+            const auto shift = slotBits * (wheel + 1);
+
+            if ((due >> shift) == (_now >> shift)) {
+                link(aNode, wheel * slotCount + ((due >> (slotBits * wheel)) & (slotCount - 1)));
+                return;
+            }
+        }
+        link(aNode, overflowList);
+    }
+
+    void TimerWheel::link(std::uint32_t aNode, std::size_t aList)
+    {
+        auto &node = _nodes[aNode];
+
+        node.list = static_cast<std::uint32_t>(aList);
+        node.prev = npos;
+        node.next = _heads[aList];
+        if (node.next != npos) {
+            _nodes[node.next].prev = aNode;
+        }
+        _heads[aList] = aNode;
+    }
+
+    void TimerWheel::unlink(std::uint32_t aNode)
+    {
+        auto &node = _nodes[aNode];
+
+        if (node.prev != npos) {
+            _nodes[node.prev].next = node.next;
+        } else {
+            _heads[node.list] = node.next;
+        }
+        if (node.next != npos) {
+            _nodes[node.next].prev = node.prev;
+        }
+        node.list = npos;
+        node.prev = npos;
+        node.next = npos;
+    }
+
+    void TimerWheel::release(std::uint32_t aNode)
+    {
+        auto &node = _nodes[aNode];
+
+        unlink(aNode);
+        if (node.owner != noOwner) {
+            if (node.ownerPrev != npos) {
+                _nodes[node.ownerPrev].ownerNext = node.ownerNext;
+            } else {
+                _owners[node.owner] = node.ownerNext;
+            }
+            if (node.ownerNext != npos) {
+                _nodes[node.ownerNext].ownerPrev = node.ownerPrev;
+            }
+        }
+        node.func = nullptr;
+        node.owner = noOwner;
+        node.ownerPrev = npos;
+        node.ownerNext = npos;
+        node.generation++;
+        _free.push_back(aNode);
+        _size--;
+    }
+
+    void TimerWheel::cascade(std::size_t aList)
+    {
+        auto node = std::exchange(_heads[aList], npos);
+
+        while (node != npos) {
+            const auto next = _nodes[node].next;
+
+            _nodes[node].list = npos;
+            place(node);
+            node = next;
+        }
+    }
+} // namespace Engine::Core
@@ -8,10 +8,30 @@
 #include "World.hpp"
 #include <algorithm>
 #include <cstddef>
+#include <string>
 #include <spdlog/spdlog.h>
 
 namespace Engine::Core {
+    namespace {
+        constexpr double millisecondsPerSecond = 1000;
+        constexpr std::size_t profiledSteps = 3;
+    } // namespace
+
     std::size_t World::createEntity()
+    {
+        const auto newIdx = allocateEntity();
+
+        spdlog::debug("Creating entity {}", newIdx);
+        for (const auto &component : _components) {
+            auto initFunc = getInitFunc(component.first);
+
+            initFunc(*this, newIdx);
+        }
+        updateQueryCaches(newIdx, signature {}.set());
+        return newIdx;
+    }
+
+    World::id World::allocateEntity()
     {
         std::size_t newIdx = 0;
 
@@ -21,23 +41,96 @@ namespace Engine::Core {
         } else {
             const auto smallestIdx = std::min_element(_ids.begin(), _ids.end());
 
-            _ids.erase(smallestIdx);
             newIdx = *smallestIdx;
+            _ids.erase(smallestIdx);
         }
-        spdlog::debug("Creating entity {}", newIdx);
-        for (const auto &component : _components) {
-            auto initFunc = getInitFunc(component.first);
+        getSignature(newIdx).reset();
+        if (newIdx >= _alive.size()) {
+            _alive.resize(newIdx + 1, 0);
+        }
+        _alive[newIdx] = 1;
+        return newIdx;
+    }
 
-            initFunc(*this, newIdx);
+    std::size_t World::createEntity(EntityIndex::externalId aExternal)
+    {
+        if (_entityIndex.find(aExternal) != nullId) {
+            throw EntityIndexExceptionAlreadyBound("External id already bound: " + std::to_string(aExternal));
         }
+        const auto newIdx = createEntity();
+
+        _entityIndex.bind(aExternal, newIdx);
         return newIdx;
     }
 
+    std::size_t World::findEntity(EntityIndex::externalId aExternal) const
+    {
+        return _entityIndex.find(aExternal);
+    }
+
+    EntityIndex::externalId World::getExternalId(std::size_t aIndex) const
+    {
+        return _entityIndex.externalOf(aIndex);
+    }
+
+    std::uint64_t World::getStateHash()
+    {
+        std::uint64_t result = 0;
+
+        for (std::size_t bit = 0; bit < _stateHashes.size(); bit++) {
+            if (_stateHashes[bit].isTracked()) {
+                result = mixHash(result ^ mixHash(flushStateHash(bit).digest() + bit));
+            }
+        }
+        return result;
+    }
+
+    StateHash &World::flushStateHash(std::size_t aBit)
+    {
+        auto *hash = findStateHash(aBit);
+
+        if (hash == nullptr) {
+            throw WorldExceptionStateHashNotTracked("State hash not tracked");
+        }
+        syncPresence();
+        hash->flush(*this);
+        return *hash;
+    }
+
+    World World::fork() const
+    {
+        World forked;
+
+        forked._components = _components;
+        forked._ids = _ids;
+        forked._nextId = _nextId;
+        forked._signatures = _signatures;
+        forked._usedBits = _usedBits;
+        forked._groups = _groups;
+        forked._queryCaches = _queryCaches;
+        forked._stateHashes = _stateHashes;
+        forked._entityIndex = _entityIndex;
+        forked._bufferSwaps = _bufferSwaps;
+        forked._presenceVersions = _presenceVersions;
+        forked._alive = _alive;
+        forked._tick = _tick;
+        forked._resources.resize(_resources.size());
+        for (std::size_t family = 0; family < _resources.size(); family++) {
+            const auto &resource = _resources[family];
+
+            if (resource && resource.get_deleter().clone != nullptr) {
+                forked._resources[family] = resourcePtr(resource.get_deleter().clone(resource.get()),
+                                                        resource.get_deleter());
+            }
+        }
+        spdlog::debug("Forked a world of {} ids", _nextId);
+        return forked;
+    }
+
     void World::killEntity(std::size_t aIndex)
     {
         spdlog::debug("Killing entity {}", aIndex);
-        _ids.push_back(aIndex);
-
+        releaseEntity(aIndex);
         for (const auto &component : _components) {
             auto eraseFunc = getEraseFunc(component.first);
 
@@ -45,11 +138,295 @@ namespace Engine::Core {
         }
     }
 
+    void World::releaseEntity(id aIndex)
+    {
+        _ids.push_back(aIndex);
+        _alive[aIndex] = 0;
+        for (auto &group : _groups) {
+            group.leave(*this, group, aIndex);
+        }
+        for (std::size_t bit = 0; bit < _stateHashes.size(); bit++) {
+            if (getSignature(aIndex).test(bit) && _stateHashes[bit].isTracked()) {
+                _stateHashes[bit].markWritten(aIndex);
+            }
+        }
+        getSignature(aIndex).reset();
+        for (auto &cache : _queryCaches) {
+            cache.erase(aIndex);
+        }
+        _scheduler->cancel(aIndex);
+        _timers.cancelOwner(aIndex);
+        _entityIndex.unbind(aIndex);
+    }
+
+    MemoryStats World::getMemoryStats() const
+    {
+        MemoryStats stats;
+
+        for (const auto &component : _components) {
+            stats += std::get<4>(component.second.second)(*this);
+        }
+        stats.bytesReserved +=
+            _signatures.capacity() * sizeof(signature) + _ids.capacity() * sizeof(id) + _alive.capacity();
+        for (const auto &cache : _queryCaches) {
+            stats.bytesReserved += cache.entities.capacity() * sizeof(id) + cache.positions.capacity() * sizeof(id);
+        }
+        stats.bytesReserved += _entityIndex.bytesReserved();
+        return stats;
+    }
+
+    void World::compact()
+    {
+        std::sort(_ids.begin(), _ids.end());
+        _ids.erase(std::unique(_ids.begin(), _ids.end()), _ids.end());
+        while (!_ids.empty() && _ids.back() + 1 == _nextId) {
+            _ids.pop_back();
+            _nextId--;
+        }
+        _ids.shrink_to_fit();
+        if (_signatures.size() > _nextId) {
+            _signatures.erase(_signatures.begin() + static_cast<std::ptrdiff_t>(_nextId), _signatures.end());
+        }
+        _signatures.shrink_to_fit();
+        _alive.resize(std::min(_alive.size(), _nextId));
+        _alive.shrink_to_fit();
+        _entityIndex.shrinkToFit(_nextId);
+        for (auto &component : _components) {
+            std::get<3>(component.second.second)(*this, _nextId);
+        }
+        for (auto &hash : _stateHashes) {
+            if (hash.isTracked()) {
+                hash.flush(*this);
+                hash.shrinkToFit(_nextId);
+            }
+        }
+        for (auto &cache : _queryCaches) {
+            if (cache.positions.size() > _nextId) {
+                cache.positions.resize(_nextId);
+            }
+            cache.positions.shrink_to_fit();
+            cache.entities.shrink_to_fit();
+        }
+        spdlog::debug("Compacted the world to {} ids", _nextId);
+    }
+
+    World::idRemap World::defragment()
+    {
+        idRemap remap(_nextId, nullId);
+        std::size_t newId = 0;
+
+        syncPresence();
+        for (std::size_t oldId = 0; oldId < _nextId; oldId++) {
+            if (!isAlive(oldId)) {
+                continue;
+            }
+            remap[oldId] = newId;
+            if (oldId != newId) {
+                const auto moved = getSignature(oldId);
+
+                getSignature(oldId).reset();
+                getSignature(newId) = moved;
+                for (auto &component : _components) {
+                    std::get<5>(component.second.second)(*this, oldId, newId);
+                }
+            }
+            newId++;
+        }
+        spdlog::debug("Defragmented the world from {} to {} ids", _nextId, newId);
+        const auto oldSize = _nextId;
+
+        _ids.clear();
+        _nextId = newId;
+        _alive.assign(newId, 1);
+        for (auto &cache : _queryCaches) {
+            if (!cache.dropped) {
+                rebuildQueryCache(cache);
+            }
+        }
+        _timers.remapOwners(remap);
+        _scheduler->remap(remap);
+        _entityIndex.remap(remap);
+        for (auto &hash : _stateHashes) {
+            if (hash.isTracked()) {
+                hash.markAll(std::max(oldSize, newId));
+            }
+        }
+        compact();
+        return remap;
+    }
+
+    void World::updateQueryCaches(std::size_t aIndex, const signature &aChanged)
+    {
+        const auto &entitySignature = getSignature(aIndex);
+
+        for (auto &cache : _queryCaches) {
+            if (!aChanged.all() && ((cache.required | cache.excluded) & aChanged).none()) {
+                continue;
+            }
+            if (cache.matches(entitySignature)) {
+                cache.insert(aIndex);
+            } else {
+                cache.erase(aIndex);
+            }
+        }
+    }
+
+    std::size_t World::registerQueryCache(const signature &aRequired, const signature &aExcluded)
+    {
+        syncPresence();
+        for (std::size_t idx = 0; idx < _queryCaches.size(); idx++) {
+            if (_queryCaches[idx].isOf(aRequired, aExcluded)) {
+                return idx;
+            }
+        }
+        auto &cache = _queryCaches.emplace_back();
+
+        cache.required = aRequired;
+        cache.excluded = aExcluded;
+        rebuildQueryCache(cache);
+        return _queryCaches.size() - 1;
+    }
+
+    void World::rebuildQueryCache(QueryCacheData &aCache)
+    {
+        aCache.entities.clear();
+        aCache.positions.assign(_nextId, nullId);
+        for (std::size_t idx = 0; idx < _nextId; idx++) {
+            if (isAlive(idx) && aCache.matches(getEntitySignature(idx))) {
+                aCache.insert(idx);
+            }
+        }
+    }
+
+    void World::syncPresence()
+    {
+        for (const auto &component : _components) {
+            std::get<6>(component.second.second)(*this);
+        }
+    }
+
     void World::runSystems()
     {
+        runSystems(_scriptClock.restart() / millisecondsPerSecond);
+    }
+
+    void World::runSystems(double aDeltaTime)
+    {
+        _scriptClock.restart();
+#ifdef ENGINE_PROFILING
+        if (_systemNames.size() != _systems.size() + profiledSteps) {
+            indexSystemNames();
+        }
+        auto name = _systemNames.begin();
+
+        _profiler.beginFrame();
         for (auto &system : _systems) {
+            const auto systemName = *name++;
+
+            if (!system.second->isDue(_tick)) {
+                continue;
+            }
+            const auto start = Profiler::clock::now();
+
+            _processedEntities = 0;
             system.second->update();
+            _profiler.recordSystem(systemName, start, Profiler::clock::now(), _processedEntities);
+        }
+        const auto start = Profiler::clock::now();
+
+        _scheduler->update(aDeltaTime);
+        _profiler.recordSystem(*name++, start, Profiler::clock::now(), _scheduler->size());
+        const auto timersStart = Profiler::clock::now();
+        const auto fired = _timers.advance(*this);
+
+        _profiler.recordSystem(*name++, timersStart, Profiler::clock::now(), fired);
+        const auto swapsStart = Profiler::clock::now();
+        const auto swapped = swapBuffers();
+
+        _profiler.recordSystem(*name, swapsStart, Profiler::clock::now(), swapped);
+        _profiler.endFrame();
+#else
+        for (auto &system : _systems) {
+            if (system.second->isDue(_tick)) {
+                system.second->update();
+            }
+        }
+        _scheduler->update(aDeltaTime);
+        _timers.advance(*this);
+        swapBuffers();
+#endif
+        _tick++;
+    }
+
+    void World::indexSystemNames()
+    {
+        _systemNames.clear();
+        for (const auto &system : _systems) {
+            _systemNames.push_back(_profiler.internName(system.first));
+        }
+        for (const auto *step : {"scripts", "timers", "buffers"}) {
+            _systemNames.push_back(_profiler.internName(step));
+        }
+    }
+
+    std::size_t World::swapBuffers()
+    {
+        std::size_t swapped = 0;
+
+        for (const auto &swap : _bufferSwaps) {
+            swapped += swap.second(*this);
         }
+        return swapped;
+    }
+
+    std::size_t World::getTick() const
+    {
+        return _tick;
+    }
+
+    void World::startScript(Script &&aScript)
+    {
+        _scheduler->start(std::move(aScript));
+    }
+
+    void World::startScript(std::size_t aIndex, Script &&aScript)
+    {
+        _scheduler->start(aIndex, std::move(aScript));
+    }
+
+    ScriptScheduler &World::getScheduler()
+    {
+        return *_scheduler;
+    }
+
+    TimerWheel::timerId World::addTimer(TimerWheel::tick aDelay, TimerWheel::timerFunc aFunc)
+    {
+        return _timers.add(aDelay, std::move(aFunc));
+    }
+
+    TimerWheel::timerId World::addTimer(std::size_t aIndex, TimerWheel::tick aDelay, TimerWheel::timerFunc aFunc)
+    {
+        return _timers.add(aDelay, std::move(aFunc), aIndex);
+    }
+
+    bool World::cancelTimer(TimerWheel::timerId aTimer)
+    {
+        return _timers.cancel(aTimer);
+    }
+
+    TimerWheel &World::getTimers()
+    {
+        return _timers;
+    }
+
+    Profiler &World::getProfiler()
+    {
+        return _profiler;
+    }
+
+    const Profiler &World::getProfiler() const
+    {
+        return _profiler;
     }
 
     std::size_t World::getCurrentId() const
@@ -1,8 +1,28 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <functional>
+#include <future>
 #include <iostream>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Core/JobSystem.hpp"
+#include "Core/Network/UdpTransport.hpp"
 #include "Core/Systems/GenericSystem.hpp"
 #include "Core/Systems/System.hpp"
 #include "Core/World.hpp"
@@ -177,3 +197,1736 @@ TEST_CASE("World", "[World]")
         REQUIRE(hp2Comp3.maxHp == hps);
     }
 }
+
+struct position
+{
+        float x;
+        float y;
+};
+
+struct velocity
+{
+        float dx;
+        float dy;
+};
+
+template<>
+struct Engine::Core::SoALayout<position>
+{
+        static constexpr auto members = std::make_tuple(&position::x, &position::y);
+};
+
+template<>
+struct Engine::Core::SoALayout<velocity>
+{
+        static constexpr auto members = std::make_tuple(&velocity::dx, &velocity::dy);
+};
+
+TEST_CASE("SoAArray", "[SoAArray]")
+{
+    Engine::Core::World world;
+    constexpr std::size_t entities = 21;
+    constexpr float delta = 0.5F;
+
+    world.registerComponents<position, velocity>();
+    static_assert(std::is_same_v<Engine::Core::StorageOf<position>, Engine::Core::SoAArray<position>>);
+    static_assert(std::is_same_v<Engine::Core::StorageOf<hp1>, Engine::Core::SparseArray<hp1>>);
+
+    for (std::size_t idx = 0; idx < entities; idx++) {
+        auto entity = world.createEntity();
+        auto value = static_cast<float>(idx);
+
+        world.addComponentToEntity(entity, position {value, -value});
+        if (idx % 4 != 0) {
+            world.emplaceComponentToEntity<velocity>(entity, 2.0F, 4.0F);
+        }
+    }
+
+    SECTION("Fields are aligned and readable")
+    {
+        auto &positions = world.getComponent<position>();
+
+        REQUIRE(reinterpret_cast<std::uintptr_t>(positions.field<0>().data()) % 64 == 0);
+        REQUIRE(positions.get(3).x == 3.0F);
+        REQUIRE(positions.get(3).y == -3.0F);
+        REQUIRE(world.getComponent<velocity>().has(4) == false);
+        REQUIRE_THROWS_AS(world.getComponent<velocity>().get(4), Engine::Core::SoAArrayExceptionEmpty);
+    }
+    SECTION("Batch iteration skips the empty slots")
+    {
+        std::size_t visited = 0;
+
+        world.getComponent<velocity>().forEachBatch(
+            [&visited](std::size_t /*first*/, std::span<float> dxs, std::span<float> dys) {
+                REQUIRE(dxs.size() == dys.size());
+                visited += dxs.size();
+            });
+        REQUIRE(visited == entities - 6);
+    }
+    SECTION("SoA components are matched by With terms")
+    {
+        std::size_t moving = 0;
+
+        static_assert(Engine::Core::IsSoAArray<Engine::Core::StorageOf<velocity>>::value);
+        world.query<Engine::Core::With<position, velocity>>().forEach(
+            0, [&moving](Engine::Core::World &aWorld, double /*deltaTime*/, std::size_t idx) {
+                REQUIRE(aWorld.getComponent<velocity>().has(idx));
+                moving++;
+            });
+        REQUIRE(moving == entities - 6);
+    }
+    SECTION("Integrate the whole fields with the SIMD kernels")
+    {
+        auto &positions = world.getComponent<position>();
+        auto &velocities = world.getComponent<velocity>();
+
+        Engine::Simd::integrate(positions.field<0>(), velocities.field<0>(), delta);
+        Engine::Simd::integrate(positions.field<1>(), velocities.field<1>(), delta);
+        for (std::size_t idx = 0; idx < entities; idx++) {
+            auto value = static_cast<float>(idx);
+            bool moving = idx % 4 != 0;
+
+            REQUIRE(positions.get(idx).x == value + (moving ? 1.0F : 0.0F));
+            REQUIRE(positions.get(idx).y == -value + (moving ? 2.0F : 0.0F));
+        }
+    }
+    SECTION("Kernels match the scalar fallback")
+    {
+        std::vector<float> values(entities, 1.0F);
+        std::vector<float> expected(entities, 1.0F);
+
+        Engine::Simd::scale(values, 3.0F);
+        Engine::Simd::Scalar::scale(expected, 3.0F);
+        REQUIRE(values == expected);
+    }
+}
+
+struct enemy
+{
+        int damage;
+};
+
+struct dead
+{
+        bool confirmed;
+};
+
+using Engine::Core::Optional;
+using Engine::Core::With;
+using Engine::Core::Without;
+
+TEST_CASE("Query filters", "[World]")
+{
+    Engine::Core::World world;
+
+    world.registerComponents<hp1, hp2, enemy, dead>();
+
+    auto alive = world.createEntity();
+    auto corpse = world.createEntity();
+    auto boss = world.createEntity();
+    auto friendly = world.createEntity();
+
+    world.addComponentToEntity(alive, hp1 {1});
+    world.addComponentToEntity(alive, enemy {1});
+    world.addComponentToEntity(corpse, hp1 {2});
+    world.addComponentToEntity(corpse, enemy {2});
+    world.addComponentToEntity(corpse, dead {true});
+    world.addComponentToEntity(boss, hp1 {3});
+    world.addComponentToEntity(boss, hp2 {30});
+    world.addComponentToEntity(boss, enemy {3});
+    world.addComponentToEntity(friendly, hp1 {4});
+
+    SECTION("With and Without")
+    {
+        std::vector<std::size_t> matched;
+
+        world.query<hp1, With<enemy>, Without<dead>>().forEach(
+            0, [&matched](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t idx, hp1 & /*hp*/) {
+                matched.push_back(idx);
+            });
+        REQUIRE(matched == std::vector<std::size_t> {alive, boss});
+    }
+    SECTION("Optional components are passed as pointers")
+    {
+        int total = 0;
+
+        world.query<hp1, Optional<hp2>>().forEach(
+            0, [&total](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/, hp1 &hp,
+                        hp2 *maxHp) {
+                total += maxHp != nullptr ? maxHp->maxHp : hp.hp;
+            });
+        REQUIRE(total == 1 + 2 + 30 + 4);
+    }
+    SECTION("Signatures follow the components and the entities")
+    {
+        world.removeComponentFromEntity<dead>(corpse);
+        REQUIRE_FALSE(world.getEntitySignature(corpse).test(world.getComponentBit<dead>()));
+        world.killEntity(boss);
+        REQUIRE(world.getEntitySignature(boss).none());
+
+        std::size_t count = 0;
+
+        world.query<With<enemy>, Without<dead>>().forEach(
+            0, [&count](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/) {
+                count++;
+            });
+        REQUIRE(count == 2);
+    }
+    SECTION("Components written through the storages are matched")
+    {
+        auto cached = world.registerQuery<hp1, With<enemy>, Without<dead>>();
+        auto matched = [&world]() {
+            std::vector<std::size_t> result;
+
+            world.query<hp1, With<enemy>, Without<dead>>().forEach(
+                0, [&result](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t idx, hp1 & /*hp*/) {
+                    result.push_back(idx);
+                });
+            return result;
+        };
+
+        world.getComponent<enemy>().emplace(friendly, 4);
+        world.getComponent<dead>().emplace(alive, true);
+        REQUIRE(matched() == std::vector<std::size_t> {boss, friendly});
+        REQUIRE(world.getEntitySignature(friendly).test(world.getComponentBit<enemy>()));
+
+        auto entities = std::vector<std::size_t>(cached.entities().begin(), cached.entities().end());
+
+        std::sort(entities.begin(), entities.end());
+        REQUIRE(entities == std::vector<std::size_t> {boss, friendly});
+        world.getComponent<enemy>().erase(boss);
+        REQUIRE(matched() == std::vector<std::size_t> {friendly});
+        REQUIRE(cached.entities().size() == 1);
+    }
+    SECTION("Queries without required components skip the freed ids")
+    {
+        auto count = [&world]() {
+            std::size_t result = 0;
+
+            world.query<Without<dead>, Optional<hp2>>().forEach(
+                0, [&result](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/,
+                             hp2 * /*maxHp*/) {
+                    result++;
+                });
+            return result;
+        };
+
+        REQUIRE(count() == 3);
+        world.killEntity(friendly);
+        REQUIRE(count() == 2);
+    }
+}
+
+struct transform
+{
+        int x;
+};
+
+struct collider
+{
+        int radius;
+};
+
+template<>
+struct Engine::Core::ComponentStorage<transform>
+{
+        using type = Engine::Core::PackedArray<transform>;
+};
+
+template<>
+struct Engine::Core::ComponentStorage<collider>
+{
+        using type = Engine::Core::PackedArray<collider>;
+};
+
+TEST_CASE("Owning groups", "[World]")
+{
+    Engine::Core::World world;
+    constexpr std::size_t entities = 10;
+
+    world.registerComponents<transform, collider>();
+    for (std::size_t idx = 0; idx < entities; idx++) {
+        auto entity = world.createEntity();
+
+        world.addComponentToEntity(entity, transform {static_cast<int>(idx)});
+        if (idx % 2 == 0) {
+            world.addComponentToEntity(entity, collider {static_cast<int>(idx) * 10});
+        }
+    }
+
+    auto group = world.registerGroup<transform, collider>();
+
+    auto checkPacked = [&world, &group]() {
+        auto &transforms = world.getComponent<transform>();
+        auto &colliders = world.getComponent<collider>();
+
+        for (std::size_t idx = 0; idx < group.size(); idx++) {
+            REQUIRE(transforms.entities()[idx] == colliders.entities()[idx]);
+            REQUIRE(transforms.data()[idx].x * 10 == colliders.data()[idx].radius);
+        }
+    };
+
+    SECTION("Existing members are packed at the front in the same order")
+    {
+        REQUIRE(group.size() == entities / 2);
+        checkPacked();
+        REQUIRE_THROWS_AS(world.registerGroup<collider>(), Engine::Core::WorldExceptionComponentAlreadyGrouped);
+    }
+    SECTION("Members join and leave the group")
+    {
+        world.addComponentToEntity(std::size_t {3}, collider {30});
+        REQUIRE(group.size() == entities / 2 + 1);
+        world.removeComponentFromEntity<collider>(0);
+        world.killEntity(4);
+        REQUIRE(world.group<transform, collider>().size() == entities / 2 - 1);
+        checkPacked();
+    }
+    SECTION("Iterate the group in lockstep")
+    {
+        int sum = 0;
+
+        group.forEach(0, [&sum](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t idx,
+                                transform &aTransform, collider &aCollider) {
+            REQUIRE(aTransform.x == static_cast<int>(idx));
+            sum += aCollider.radius;
+        });
+        REQUIRE(sum == (0 + 2 + 4 + 6 + 8) * 10);
+    }
+    SECTION("Removing a component drops its group")
+    {
+        std::size_t visited = 0;
+
+        world.removeComponent<collider>();
+        world.killEntity(2);
+
+        auto transforms = world.registerGroup<transform>();
+
+        REQUIRE(group.size() == 0);
+        REQUIRE(transforms.size() == entities - 1);
+        group.forEach(0, [&visited](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/,
+                                    transform & /*aTransform*/, collider & /*aCollider*/) {
+            visited++;
+        });
+        REQUIRE(visited == 0);
+    }
+}
+
+TEST_CASE("Profiler", "[Profiler]")
+{
+    Engine::Profiler profiler;
+    auto start = Engine::Profiler::clock::now();
+
+    SECTION("Rolling statistics")
+    {
+        profiler.setWindowSize(4);
+        for (int idx = 1; idx <= 8; idx++) {
+            profiler.recordSystem("Move", start, start + std::chrono::milliseconds(idx), 10);
+        }
+        auto stats = profiler.getSystemStats("Move");
+
+        REQUIRE(stats.count == 4);
+        REQUIRE(stats.max == 8.0);
+        REQUIRE(stats.p50 >= 6.0);
+        REQUIRE(profiler.getSystemStats("Unknown").count == 0);
+        REQUIRE(profiler.getName(profiler.getTrace().back().name) == "Move");
+        REQUIRE(profiler.internName("Move") == profiler.getTrace().back().name);
+    }
+    SECTION("Chrome trace export")
+    {
+        std::ostringstream trace;
+
+        profiler.recordSystem("Move \"fast\"", start, start + std::chrono::microseconds(5), 3);
+        profiler.recordCounter("queued events", 2);
+        profiler.exportChromeTrace(trace);
+        REQUIRE(trace.str().find(R"("name":"Move \"fast\"","ph":"X")") != std::string::npos);
+        REQUIRE(trace.str().find(R"("args":{"entities":3})") != std::string::npos);
+        REQUIRE(trace.str().find(R"("ph":"C")") != std::string::npos);
+    }
+#ifdef ENGINE_PROFILING
+    SECTION("World records its systems")
+    {
+        Engine::App app;
+
+        app.addWorld(0);
+        app.setCurrentWorld(0);
+        auto &world = *app[0];
+
+        world.registerComponents<hp1, hp2>();
+        world.addComponentToEntity(world.createEntity(), hp1 {1});
+        world.addComponentToEntity(world.createEntity(), hp1 {1});
+        auto system = Engine::Core::createSystem<hp1>(
+            world, "Regen", [](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/, hp1 &hp) {
+                hp.hp++;
+            });
+
+        world.addSystem(system);
+        world.runSystems();
+        world.runSystems();
+        REQUIRE(app.getFrameStats().count == 2);
+        REQUIRE(app.getSystemStats("Regen").count == 2);
+        REQUIRE(world.getProfiler().getTrace().front().value == 2);
+    }
+#endif
+}
+
+TEST_CASE("Memory compaction", "[World]")
+{
+    Engine::Core::World world;
+    constexpr std::size_t entities = 1000;
+    constexpr std::size_t survivors = 10;
+
+    world.registerComponents<hp1, position, transform>();
+    for (std::size_t idx = 0; idx < entities; idx++) {
+        auto entity = world.createEntity();
+
+        world.addComponentToEntity(entity, hp1 {1});
+        world.addComponentToEntity(entity, position {1, 2});
+        world.addComponentToEntity(entity, transform {static_cast<int>(idx)});
+    }
+    const auto peak = world.getMemoryStats();
+
+    REQUIRE(peak.liveSlots == entities * 3);
+    REQUIRE(peak.occupancy() == 1.0);
+    REQUIRE(world.getMemoryStats<hp1>().bytesLive == entities * sizeof(hp1));
+    for (std::size_t idx = survivors; idx < entities; idx++) {
+        world.killEntity(idx);
+    }
+    world.killEntity(3);
+    REQUIRE(world.getMemoryStats().bytesReserved >= peak.bytesReserved);
+    REQUIRE(world.getMemoryStats<hp1>().occupancy() < 0.1);
+
+    world.compact();
+    const auto compacted = world.getMemoryStats();
+
+    REQUIRE(world.getCurrentId() == survivors);
+    REQUIRE(compacted.bytesReserved < peak.bytesReserved / 10);
+    REQUIRE(compacted.liveSlots == (survivors - 1) * 3);
+    REQUIRE(world.getComponent<hp1>().size() == survivors);
+    REQUIRE(world.getComponent<transform>().get(9).x == 9);
+    REQUIRE(world.createEntity() == 3);
+    REQUIRE(world.createEntity() == survivors);
+
+    SECTION("Storages trim their trailing empty slots")
+    {
+        Engine::Core::SparseArray<hp1> array;
+
+        array.init(99);
+        array.set(4, hp1 {1});
+        REQUIRE(array.memoryStats().slots == 100);
+        REQUIRE(array.compact() == 5);
+        REQUIRE(array.memoryStats().bytesReserved == 5 * sizeof(std::optional<hp1>));
+        array.shrinkToFit(2);
+        REQUIRE(array.size() == 5);
+    }
+}
+
+TEST_CASE("Defragmentation", "[World]")
+{
+    Engine::Core::World world;
+    constexpr std::size_t entities = 100;
+
+    world.registerComponents<hp1, position, transform, collider>();
+    for (std::size_t idx = 0; idx < entities; idx++) {
+        auto entity = world.createEntity();
+
+        world.addComponentToEntity(entity, hp1 {static_cast<int>(idx)});
+        world.addComponentToEntity(entity, transform {static_cast<int>(idx)});
+        if (idx % 2 == 0) {
+            world.addComponentToEntity(entity, position {static_cast<float>(idx), 0});
+            world.addComponentToEntity(entity, collider {static_cast<int>(idx) * 10});
+        }
+    }
+    auto group = world.registerGroup<transform, collider>();
+
+    for (std::size_t idx = 0; idx < entities; idx++) {
+        if (idx != 6 && idx != 51 && idx != 98) {
+            world.killEntity(idx);
+        }
+    }
+    const auto remap = world.defragment();
+
+    REQUIRE(remap.size() == entities);
+    REQUIRE(remap[6] == 0);
+    REQUIRE(remap[51] == 1);
+    REQUIRE(remap[98] == 2);
+    REQUIRE(remap[7] == Engine::Core::World::nullId);
+    REQUIRE(world.getCurrentId() == 3);
+    REQUIRE(world.getComponent<hp1>().size() == 3);
+    REQUIRE(world.getComponent<hp1>()[1].hp == 51);
+    REQUIRE(world.getComponent<position>().get(2).x == 98);
+    REQUIRE_FALSE(world.getComponent<position>().has(1));
+    REQUIRE(world.getComponent<transform>().get(2).x == 98);
+    REQUIRE(world.hasComponents<hp1, collider>(0));
+    REQUIRE_FALSE(world.hasComponents<collider>(1));
+    REQUIRE(group.size() == 2);
+
+    std::size_t visited = 0;
+
+    group.forEach(0, [&visited](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t idx, transform &trans,
+                                collider &coll) {
+        REQUIRE(trans.x * 10 == coll.radius);
+        REQUIRE((idx == 0 || idx == 2));
+        visited++;
+    });
+    REQUIRE(visited == 2);
+    REQUIRE(world.createEntity() == 3);
+}
+
+TEST_CASE("Multi-world ticking", "[App]")
+{
+    Engine::Core::JobSystem jobs(3);
+    Engine::App app;
+    constexpr std::size_t worlds = 8;
+
+    app.setJobSystem(jobs);
+    for (std::size_t key = 0; key < worlds; key++) {
+        auto &world = *app.addWorld(key);
+
+        world.registerComponents<hp1>();
+        world.addComponentToEntity(world.createEntity(), hp1 {0});
+        auto system = Engine::Core::createSystem<hp1>(
+            world, "Count", [](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/, hp1 &hp) {
+                hp.hp++;
+            });
+
+        world.addSystem(system);
+        if (key % 2 == 0) {
+            app.addWorldTag(key, "match");
+        }
+    }
+    auto steps = [&app](std::size_t aKey) {
+        return app[aKey]->getComponent<hp1>()[0].hp;
+    };
+
+    SECTION("Every world or a tag")
+    {
+        app.tick(0);
+        app.tick(0, "match");
+        REQUIRE(steps(0) == 2);
+        REQUIRE(steps(1) == 1);
+        REQUIRE(app.getTickStats().worlds == worlds / 2);
+        REQUIRE(app.getTickStats().steps == worlds / 2);
+        REQUIRE(app.getTickDurationStats().count == 2);
+        REQUIRE_THROWS_AS(app.addWorldTag(worlds, "match"), Engine::AppExceptionKeyNotFound);
+    }
+    SECTION("Tick rates and overload policies")
+    {
+        app.setTickRate(0, 10);
+        app.setTickRate(1, 10);
+        app.tick(0.05);
+        REQUIRE(steps(0) == 0);
+        app.tick(0.1);
+        REQUIRE(steps(0) == 1);
+        REQUIRE(steps(2) == 2);
+        app.setOverloadPolicy(Engine::OverloadPolicy::CatchUp, 3);
+        app.tick(0.5);
+        REQUIRE(steps(0) == 4);
+        REQUIRE(app.getTickStats().droppedSteps == 4);
+        REQUIRE(std::abs(app[0]->getScheduler().getTime() - 0.4) < 1e-9);
+        app.setOverloadPolicy(Engine::OverloadPolicy::Skip);
+        app.tick(0.2);
+        REQUIRE(steps(1) == 5);
+        REQUIRE(app.getTickStats().droppedSteps == 2);
+        REQUIRE(app.getTickStats().saturation >= 0);
+    }
+}
+
+TEST_CASE("Background world loading", "[App]")
+{
+    Engine::App app;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+
+    app.addWorld(0);
+    app.setCurrentWorld(0);
+    app.loadWorldAsync(1, [released](Engine::Core::World &world, const Engine::App<>::progressFunc &report) {
+        world.registerComponents<hp1>();
+        report(0.5F);
+        released.wait();
+        world.addComponentToEntity(world.createEntity(), hp1 {42});
+    });
+    REQUIRE_THROWS_AS(app.loadWorldAsync(1, {}), Engine::AppExceptionKeyAlreadyExists);
+    REQUIRE_THROWS_AS(app.addWorld(1), Engine::AppExceptionKeyAlreadyExists);
+    app.setCurrentWorld(1, true);
+    while (app.getLoadProgress(1) < 0.5F) {
+        std::this_thread::yield();
+    }
+    app.tick(0);
+    REQUIRE(app.getCurrentWorld() == app[0]);
+    REQUIRE_THROWS_AS(app[1], Engine::AppExceptionKeyNotFound);
+
+    auto *first = app[0].get();
+
+    release.set_value();
+    while (app.getCurrentWorld().get() == first) {
+        app.syncWorlds();
+        std::this_thread::yield();
+    }
+    REQUIRE(app.getLoadProgress(1) == 1);
+    REQUIRE(app.getCurrentWorld()->getComponent<hp1>()[0].hp == 42);
+    REQUIRE_THROWS_AS(app[0], Engine::AppExceptionKeyNotFound);
+
+    app.loadWorldAsync(2, [](Engine::Core::World & /*world*/, const Engine::App<>::progressFunc & /*report*/) {
+        throw std::runtime_error("missing asset");
+    });
+    while (true) {
+        try {
+            app.syncWorlds();
+        } catch (const std::runtime_error &error) {
+            REQUIRE(std::string(error.what()) == "missing asset");
+            break;
+        }
+        std::this_thread::yield();
+    }
+    REQUIRE_THROWS_AS(app.getLoadProgress(2), Engine::AppExceptionKeyNotFound);
+}
+
+struct bossHit
+{
+        int damage;
+};
+
+namespace {
+    Engine::Core::Script bossPattern(std::vector<std::string> &log)
+    {
+        log.emplace_back("spawn");
+        co_await Engine::Core::nextFrame();
+        log.emplace_back("frame");
+        co_await Engine::Core::seconds(1);
+        log.emplace_back("cooldown");
+        auto hit = co_await Engine::Core::event<bossHit>();
+        log.emplace_back("hit " + std::to_string(hit.damage));
+    }
+
+    Engine::Core::Script patrol(int &steps)
+    {
+        while (true) {
+            steps++;
+            co_await Engine::Core::nextFrame();
+        }
+    }
+
+    Engine::Core::Script failing()
+    {
+        co_await Engine::Core::nextFrame();
+        throw std::runtime_error("script failed");
+    }
+} // namespace
+
+TEST_CASE("Coroutine scripts", "[Script]")
+{
+    Engine::Core::World world;
+    auto &scheduler = world.getScheduler();
+    auto &events = Engine::Event::EventManager::getInstance();
+    std::vector<std::string> log;
+
+    SECTION("Scripts resume only when due")
+    {
+        world.startScript(bossPattern(log));
+        REQUIRE(log == std::vector<std::string> {"spawn"});
+        scheduler.update(0.5);
+        scheduler.update(0.5);
+        REQUIRE(log.size() == 2);
+        scheduler.update(0.5);
+        REQUIRE(log.back() == "cooldown");
+        scheduler.update(0.5);
+        REQUIRE(log.size() == 3);
+        events.pushEvent(bossHit {12});
+        scheduler.update(0.5);
+        REQUIRE(log.back() == "hit 12");
+        REQUIRE(scheduler.size() == 0);
+        events.getEventsByType<bossHit>().clear();
+    }
+    SECTION("Entity scripts stop with their entity")
+    {
+        int steps = 0;
+        auto entity = world.createEntity();
+
+        world.startScript(entity, patrol(steps));
+        world.startScript(patrol(steps));
+        scheduler.update(0);
+        REQUIRE(steps == 4);
+        world.killEntity(entity);
+        scheduler.update(0);
+        REQUIRE(steps == 5);
+        REQUIRE(scheduler.size() == 1);
+    }
+    SECTION("Entity scripts follow defragmentation")
+    {
+        int steps = 0;
+        auto first = world.createEntity();
+        auto second = world.createEntity();
+
+        world.startScript(second, patrol(steps));
+        world.killEntity(first);
+        REQUIRE(world.defragment()[second] == 0);
+        scheduler.update(0);
+        REQUIRE(steps == 2);
+        world.killEntity(0);
+        scheduler.update(0);
+        REQUIRE(steps == 2);
+        REQUIRE(scheduler.size() == 0);
+    }
+    SECTION("Scripts wait for the time of the ticks")
+    {
+        world.startScript(bossPattern(log));
+        world.runSystems(0.5);
+        world.runSystems(0.5);
+        REQUIRE(log.size() == 2);
+        world.runSystems(0.5);
+        REQUIRE(log.back() == "cooldown");
+    }
+    SECTION("Errors are rethrown by update")
+    {
+        world.startScript(failing());
+        REQUIRE_THROWS_AS(scheduler.update(0), std::runtime_error);
+        REQUIRE(scheduler.size() == 0);
+    }
+    SECTION("Frames are recycled")
+    {
+        constexpr std::size_t frameSize = 100;
+        void *frame = Engine::Core::ScriptFramePool::allocate(frameSize);
+
+        Engine::Core::ScriptFramePool::deallocate(frame, frameSize);
+        REQUIRE(Engine::Core::ScriptFramePool::allocate(frameSize - 10) == frame);
+        Engine::Core::ScriptFramePool::deallocate(frame, frameSize);
+    }
+}
+
+template<std::size_t Index>
+struct lateEvent
+{
+        std::size_t value;
+};
+
+template<std::size_t... Indexes>
+void registerLateEvents(Engine::Event::EventManager &aManager, std::index_sequence<Indexes...> /*indexes*/)
+{
+    aManager.initEventHandlers<lateEvent<Indexes + 1>...>();
+}
+
+TEST_CASE("Job system", "[JobSystem]")
+{
+    Engine::Core::JobSystem jobs(3);
+
+    SECTION("Work-stealing deque")
+    {
+        Engine::Core::WorkStealingDeque<int> deque(2);
+
+        for (int idx = 0; idx < 5; idx++) {
+            deque.push(idx);
+        }
+        REQUIRE(deque.size() == 5);
+        REQUIRE(deque.steal() == 0);
+        REQUIRE(deque.pop() == 4);
+        REQUIRE(deque.steal() == 1);
+        REQUIRE(deque.pop() == 3);
+        REQUIRE(deque.pop() == 2);
+        REQUIRE_FALSE(deque.pop().has_value());
+        REQUIRE_FALSE(deque.steal().has_value());
+    }
+    SECTION("Nested jobs and counters")
+    {
+        constexpr std::size_t count = 100000;
+        std::vector<int> values(count, 1);
+        std::atomic<std::size_t> sum {0};
+
+        jobs.parallelFor(count, 1000, [&jobs, &values, &sum](std::size_t aBegin, std::size_t aEnd) {
+            jobs.parallelFor(aEnd - aBegin, 100, [&values, &sum, aBegin](std::size_t aFirst, std::size_t aLast) {
+                for (auto idx = aBegin + aFirst; idx < aBegin + aLast; idx++) {
+                    sum += static_cast<std::size_t>(values[idx]);
+                }
+            });
+        });
+        REQUIRE(sum == count);
+    }
+    SECTION("Dependencies and errors")
+    {
+        Engine::Core::JobCounter first;
+        Engine::Core::JobCounter second;
+        std::atomic<int> step {0};
+        int seen = 0;
+
+        jobs.submit(
+            [&step]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                step = 1;
+            },
+            first);
+        jobs.submitAfter(
+            first,
+            [&step, &seen]() {
+                seen = step.load();
+            },
+            second);
+        jobs.wait(second);
+        REQUIRE(seen == 1);
+        REQUIRE(first.isDone());
+        jobs.submit(
+            []() {
+                throw std::runtime_error("job failed");
+            },
+            first);
+        REQUIRE_THROWS_AS(jobs.wait(first), std::runtime_error);
+        REQUIRE_NOTHROW(jobs.wait(first));
+    }
+    SECTION("Parallel queries")
+    {
+        Engine::Core::World world;
+        constexpr std::size_t entities = 5000;
+
+        world.registerComponents<hp1, hp2>();
+        for (std::size_t idx = 0; idx < entities; idx++) {
+            auto entity = world.createEntity();
+
+            world.addComponentToEntity(entity, hp1 {1});
+            if (idx % 5 == 0) {
+                world.addComponentToEntity(entity, hp2 {0});
+            }
+        }
+        world.query<hp1, Engine::Core::Without<hp2>>().forEachParallel(
+            0,
+            [](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/, hp1 &hp) {
+                hp.hp++;
+            },
+            128, jobs);
+        std::size_t healed = 0;
+
+        for (std::size_t idx = 0; idx < entities; idx++) {
+            healed += world.getComponent<hp1>()[idx].hp == 2 ? 1U : 0U;
+        }
+        REQUIRE(healed == entities - entities / 5);
+    }
+    SECTION("Event handlers registered from jobs")
+    {
+        auto &manager = Engine::Event::EventManager::getInstance();
+        Engine::Core::JobCounter registered;
+        constexpr std::size_t pushes = 1000;
+
+        manager.initEventHandler<lateEvent<0>>();
+        jobs.submit(
+            [&manager]() {
+                registerLateEvents(manager, std::make_index_sequence<16>());
+            },
+            registered);
+        for (std::size_t idx = 0; idx < pushes; idx++) {
+            manager.pushEvent(lateEvent<0> {idx});
+            manager.getEventCount();
+        }
+        jobs.wait(registered);
+        REQUIRE(manager.getEventsByType<lateEvent<0>>().size() == pushes);
+        REQUIRE(manager.getEventCount() >= pushes);
+        manager.keepEventsAndClear<>();
+    }
+}
+
+struct inputState
+{
+        bool jump = false;
+};
+
+struct gameConfig
+{
+        int gravity;
+};
+
+TEST_CASE("World resources", "[World]")
+{
+    Engine::Core::World world;
+
+    REQUIRE_FALSE(world.hasResource<gameConfig>());
+    REQUIRE_THROWS_AS(world.getResource<gameConfig>(), Engine::Core::WorldExceptionResourceNotFound);
+    world.insertResource<gameConfig>(gameConfig {10});
+    world.insertResource<inputState>().jump = true;
+    REQUIRE(world.getResource<gameConfig>().gravity == 10);
+    world.insertResource<gameConfig>(gameConfig {20});
+    REQUIRE(std::as_const(world).getResource<gameConfig>().gravity == 20);
+
+    SECTION("Read and Write query terms")
+    {
+        world.registerComponents<hp1>();
+        world.addComponentToEntity(world.createEntity(), hp1 {0});
+        world.addComponentToEntity(world.createEntity(), hp1 {0});
+        auto system = Engine::Core::createSystem<hp1, Engine::Core::Read<gameConfig>, Engine::Core::Write<inputState>>(
+            world, "Fall",
+            [](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/, hp1 &hp,
+               const gameConfig &config, inputState &input) {
+                hp.hp -= config.gravity;
+                input.jump = false;
+            });
+        auto reader = Engine::Core::createSystem<hp1, Engine::Core::Read<gameConfig>>(
+            world, "Read", [](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/,
+                              hp1 & /*hp*/, const gameConfig & /*config*/) {});
+        auto writer = Engine::Core::createSystem<Engine::Core::Write<gameConfig>>(
+            world, "Write", [](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/,
+                               gameConfig & /*config*/) {});
+
+        REQUIRE_FALSE(system.second->conflictsWith(*reader.second));
+        REQUIRE(system.second->conflictsWith(*writer.second));
+        REQUIRE(writer.second->conflictsWith(*reader.second));
+        world.addSystem(system);
+        world.runSystems();
+        REQUIRE(world.getComponent<hp1>()[1].hp == -20);
+        REQUIRE_FALSE(world.getResource<inputState>().jump);
+    }
+    SECTION("Remove a resource")
+    {
+        world.removeResource<gameConfig>();
+        REQUIRE_FALSE(world.hasResource<gameConfig>());
+        REQUIRE(world.hasResource<inputState>());
+    }
+}
+
+struct frozen
+{};
+
+struct selected
+{};
+
+TEST_CASE("Tag components", "[World]")
+{
+    static_assert(Engine::Core::IsTagArray<Engine::Core::StorageOf<frozen>>::value);
+    constexpr std::size_t count = 200;
+    Engine::Core::World world;
+
+    world.registerComponents<hp1, frozen, selected>();
+    for (std::size_t idx = 0; idx < count; idx++) {
+        auto entity = world.createEntity();
+
+        world.addComponentToEntity(entity, hp1 {static_cast<int>(entity)});
+        if (entity % 3 == 0) {
+            world.addComponentToEntity(entity, frozen {});
+        }
+        if (entity % 5 == 0) {
+            world.addComponentToEntity(entity, selected {});
+        }
+    }
+    REQUIRE(world.getComponent<frozen>().has(3));
+    REQUIRE_FALSE(world.getComponent<frozen>().has(4));
+    REQUIRE_THROWS_AS(world.getComponent<frozen>().get(4), Engine::Core::TagArrayExceptionEmpty);
+    REQUIRE(world.getComponent<frozen>().count() == (count + 2) / 3);
+    REQUIRE(world.getMemoryStats<frozen>().bytesLive == 0);
+
+    SECTION("Queries filter on the tag words")
+    {
+        std::vector<std::size_t> matched;
+        std::vector<std::size_t> expected;
+
+        world.query<hp1, With<frozen>, Without<selected>>().forEach(
+            0, [&matched](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t idx, hp1 &hp) {
+                REQUIRE(hp.hp == static_cast<int>(idx));
+                matched.push_back(idx);
+            });
+        for (std::size_t idx = 0; idx < count; idx++) {
+            if (idx % 3 == 0 && idx % 5 != 0) {
+                expected.push_back(idx);
+            }
+        }
+        REQUIRE(matched == expected);
+
+        std::atomic<std::size_t> parallelCount = 0;
+        std::atomic<bool> mismatch = false;
+
+        world.query<frozen, selected>().forEachParallel(
+            0,
+            [&parallelCount, &mismatch](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t idx,
+                                        frozen & /*frozen*/, selected & /*selected*/) {
+                mismatch = mismatch || idx % 15 != 0;
+                parallelCount++;
+            },
+            16);
+        REQUIRE_FALSE(mismatch);
+        REQUIRE(parallelCount == (count + 14) / 15);
+    }
+    SECTION("Tags follow the entities")
+    {
+        world.removeComponentFromEntity<frozen>(3);
+        world.killEntity(6);
+        REQUIRE_FALSE(world.getComponent<frozen>().has(3));
+        REQUIRE_FALSE(world.getComponent<frozen>().has(6));
+
+        std::size_t frozenCount = 0;
+
+        world.query<With<frozen>>().forEach(
+            0, [&frozenCount](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/) {
+                frozenCount++;
+            });
+        REQUIRE(frozenCount == (count + 2) / 3 - 2);
+    }
+}
+
+TEST_CASE("Cached queries", "[World]")
+{
+    Engine::Core::World world;
+
+    world.registerComponents<hp1, enemy, dead>();
+    for (std::size_t idx = 0; idx < 10; idx++) {
+        auto entity = world.createEntity();
+
+        world.addComponentToEntity(entity, hp1 {static_cast<int>(entity)});
+        if (entity % 2 == 0) {
+            world.addComponentToEntity(entity, enemy {1});
+        }
+    }
+    auto cached = world.registerQuery<hp1, With<enemy>, Without<dead>>();
+    auto matchedBy = [&world](auto &&aQuery) {
+        std::vector<std::size_t> matched;
+
+        aQuery.forEach(0, [&matched](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t idx,
+                                     hp1 &hp) {
+            REQUIRE(hp.hp == static_cast<int>(idx));
+            matched.push_back(idx);
+        });
+        std::sort(matched.begin(), matched.end());
+        return matched;
+    };
+    auto expected = [&world, &matchedBy]() {
+        return matchedBy(world.query<hp1, With<enemy>, Without<dead>>());
+    };
+
+    REQUIRE(cached.size() == 5);
+    REQUIRE(matchedBy(cached) == expected());
+    REQUIRE(world.registerQuery<hp1, With<enemy>, Without<dead>>().size() == 5);
+    REQUIRE_THROWS_AS(world.cachedQuery<hp1>(), Engine::Core::WorldExceptionQueryNotRegistered);
+
+    SECTION("The cache follows the components")
+    {
+        world.addComponentToEntity(1, enemy {2});
+        world.addComponentToEntity(2, dead {true});
+        world.removeComponentFromEntity<enemy>(4);
+        world.killEntity(6);
+        REQUIRE(matchedBy(world.cachedQuery<hp1, With<enemy>, Without<dead>>())
+                == std::vector<std::size_t> {0, 1, 8});
+        REQUIRE(matchedBy(cached) == expected());
+
+        auto entity = world.createEntity();
+
+        world.addComponentToEntity(entity, hp1 {static_cast<int>(entity)});
+        world.addComponentToEntity(entity, enemy {3});
+        REQUIRE(matchedBy(cached) == expected());
+    }
+    SECTION("Queries without required components see the new entities")
+    {
+        auto alive = world.registerQuery<Without<dead>>();
+
+        REQUIRE(alive.size() == 10);
+        world.killEntity(3);
+        world.createEntity();
+        world.createEntity();
+        REQUIRE(alive.size() == 11);
+    }
+    SECTION("Defragmentation rebuilds the cache")
+    {
+        world.killEntity(0);
+        world.killEntity(2);
+        world.defragment();
+        REQUIRE(world.getCurrentId() == 8);
+
+        std::vector<std::size_t> matched;
+
+        cached.forEach(0, [&matched](Engine::Core::World &aWorld, double /*deltaTime*/, std::size_t idx,
+                                     hp1 & /*hp*/) {
+            REQUIRE(aWorld.hasComponents<enemy>(idx));
+            matched.push_back(idx);
+        });
+        REQUIRE(matched.size() == 3);
+    }
+    SECTION("Removing a component drops its caches")
+    {
+        auto all = world.registerQuery<hp1>();
+
+        world.removeComponent<dead>();
+        REQUIRE_THROWS_AS((world.cachedQuery<hp1, With<enemy>>()), Engine::Core::WorldExceptionQueryNotRegistered);
+        REQUIRE(cached.size() == 0);
+        REQUIRE(all.size() == 10);
+        world.registerComponent<dead>();
+        world.emplaceComponentToEntity<dead>(0, true);
+        REQUIRE(cached.size() == 0);
+        REQUIRE(world.registerQuery<hp1, With<enemy>, Without<dead>>().size() == 4);
+    }
+}
+
+TEST_CASE("World forks", "[World]")
+{
+    Engine::Core::World world;
+
+    world.registerComponents<hp1, hp2, frozen>();
+    world.insertResource<gameConfig>(gameConfig {10});
+    world.insertResource<std::unique_ptr<int>>(std::make_unique<int>(1));
+    for (std::size_t idx = 0; idx < 8; idx++) {
+        auto entity = world.createEntity();
+
+        world.addComponentToEntity(entity, hp1 {static_cast<int>(entity)});
+        world.addComponentToEntity(entity, hp2 {static_cast<int>(entity) * 10});
+    }
+    auto cached = world.registerQuery<hp1, Without<frozen>>();
+    auto branch = world.fork();
+
+    REQUIRE(world.isStorageShared<hp1>());
+    REQUIRE(branch.isStorageShared<hp2>());
+    REQUIRE(branch.getCurrentId() == world.getCurrentId());
+    REQUIRE(branch.getResource<gameConfig>().gravity == 10);
+    REQUIRE_FALSE(branch.hasResource<std::unique_ptr<int>>());
+
+    SECTION("Writes only copy the written storages")
+    {
+        branch.query<hp1>().forEach(0, [](Engine::Core::World & /*world*/, double /*deltaTime*/,
+                                          std::size_t /*idx*/, hp1 &hp) {
+            hp.hp += 100;
+        });
+        REQUIRE_FALSE(branch.isStorageShared<hp1>());
+        REQUIRE_FALSE(world.isStorageShared<hp1>());
+        REQUIRE(world.isStorageShared<hp2>());
+        REQUIRE(branch.getComponent<hp1>()[3].hp == 103);
+        REQUIRE(world.getComponent<hp1>()[3].hp == 3);
+    }
+    SECTION("The entities of a fork live on their own")
+    {
+        branch.killEntity(2);
+        branch.addComponentToEntity(4, frozen {});
+        branch.getResource<gameConfig>().gravity = 20;
+        REQUIRE(world.getComponent<hp1>().has(2));
+        REQUIRE(world.getResource<gameConfig>().gravity == 10);
+        REQUIRE(cached.size() == 8);
+        REQUIRE(branch.cachedQuery<hp1, Without<frozen>>().size() == 6);
+
+        auto nested = branch.fork();
+
+        REQUIRE(branch.isStorageShared<hp2>());
+        REQUIRE(nested.createEntity() == 2);
+        REQUIRE_FALSE(nested.isStorageShared<hp2>());
+        REQUIRE(nested.getComponent<hp2>()[5].maxHp == 50);
+    }
+}
+
+struct paddedStat
+{
+        std::uint8_t level;
+        std::uint32_t experience;
+};
+
+TEST_CASE("World state hashes", "[World]")
+{
+    auto build = []() {
+        auto world = std::make_unique<Engine::Core::World>();
+
+        world->registerComponents<hp1, hp2, frozen>();
+        world->trackStateHash<hp1>();
+        world->trackStateHash<frozen>();
+        for (std::size_t idx = 0; idx < 100; idx++) {
+            auto entity = world->createEntity();
+
+            world->addComponentToEntity(entity, hp1 {static_cast<int>(entity)});
+            if (entity % 4 == 0) {
+                world->addComponentToEntity(entity, frozen {});
+            }
+        }
+        return world;
+    };
+    auto local = build();
+    auto remote = build();
+    auto damage = [](Engine::Core::World &aWorld, int aAmount) {
+        aWorld.query<hp1, Without<frozen>>().forEach(
+            0, [aAmount](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/, hp1 &hp) {
+                hp.hp -= aAmount;
+            });
+    };
+    const auto initial = local->getStateHash();
+
+    REQUIRE(initial == remote->getStateHash());
+    REQUIRE(initial != 0);
+    REQUIRE_THROWS_AS(local->getStateHash<hp2>(), Engine::Core::WorldExceptionStateHashNotTracked);
+    REQUIRE_FALSE(Engine::Core::HashableComponent<double>);
+    REQUIRE_FALSE(Engine::Core::HashableComponent<paddedStat>);
+
+    SECTION("Written slots are rehashed")
+    {
+        damage(*local, 1);
+        damage(*remote, 1);
+        REQUIRE(local->getStateHash() == remote->getStateHash());
+        REQUIRE(local->getStateHash() != initial);
+        damage(*local, -1);
+        REQUIRE(local->getStateHash() == initial);
+        REQUIRE(local->fork().getStateHash() == initial);
+    }
+    SECTION("Read-only terms")
+    {
+        auto branch = local->fork();
+        int total = 0;
+
+        branch.query<const hp1, Without<frozen>>().forEach(
+            0, [&total](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/, const hp1 &hp) {
+                total += hp.hp;
+            });
+        REQUIRE(total == 3750);
+        REQUIRE(branch.isStorageShared<hp1>());
+        REQUIRE(branch.getStateHash() == initial);
+    }
+    SECTION("Drill down to the diverging entity")
+    {
+        remote->getComponent<hp1>()[42].hp = 7;
+        remote->markWritten<hp1>(42);
+        local->removeComponentFromEntity<frozen>(8);
+        REQUIRE(local->getStateHash() != remote->getStateHash());
+        REQUIRE(Engine::Core::findDivergence(local->getSlotHashes<hp1>(), remote->getSlotHashes<hp1>()) == 42);
+        REQUIRE(Engine::Core::findDivergence(local->getSlotHashes<frozen>(), remote->getSlotHashes<frozen>()) == 8);
+        REQUIRE(Engine::Core::findDivergence(local->getSlotHashes<hp1>(), local->getSlotHashes<hp1>())
+                == std::numeric_limits<std::size_t>::max());
+    }
+    SECTION("Killed and moved entities")
+    {
+        local->killEntity(10);
+        remote->killEntity(10);
+        remote->killEntity(99);
+        REQUIRE(local->getStateHash() != remote->getStateHash());
+        local->killEntity(99);
+        local->defragment();
+        remote->defragment();
+        REQUIRE(local->getStateHash() == remote->getStateHash());
+        REQUIRE(local->getSlotHashes<hp1>().size() == 98);
+    }
+}
+
+struct playerMoved
+{
+        std::uint32_t player;
+        float x;
+        float y;
+};
+
+struct chatMessage
+{
+        std::string text;
+};
+
+TEST_CASE("Batched UDP transport", "[Network]")
+{
+    using Engine::Network::UdpTransport;
+    const UdpTransport::endpoint loopback {boost::asio::ip::address_v4::loopback(), 0};
+    UdpTransport server(loopback);
+    UdpTransport client(loopback, 8);
+    auto &events = Engine::Event::EventManager::getInstance();
+
+    server.registerMessage<playerMoved>(1);
+    server.registerMessage<chatMessage>(
+        2, [](std::span<const std::byte> aPayload, const UdpTransport::endpoint & /*aFrom*/) {
+            return std::optional<chatMessage>(
+                chatMessage {std::string(reinterpret_cast<const char *>(aPayload.data()), aPayload.size())});
+        });
+    client.registerMessage<playerMoved>(1);
+    REQUIRE_THROWS_AS(client.registerMessage<chatMessage>(1, nullptr),
+                      Engine::Network::UdpTransportExceptionMessageAlreadyRegistered);
+    REQUIRE_THROWS_AS(client.sendRaw(server.localEndpoint(), 3, std::vector<std::byte>(2000)),
+                      Engine::Network::UdpTransportExceptionMessageTooLarge);
+
+    constexpr std::size_t moves = 20;
+    const std::string hello = "hello";
+
+    for (std::size_t idx = 0; idx < moves; idx++) {
+        client.send(server.localEndpoint(), playerMoved {static_cast<std::uint32_t>(idx), 1.0F, 2.0F});
+    }
+    client.sendRaw(server.localEndpoint(), 2,
+                   std::span<const std::byte>(reinterpret_cast<const std::byte *>(hello.data()), hello.size()));
+    client.sendRaw(server.localEndpoint(), 42, {});
+    client.flush();
+    client.dispatch();
+    REQUIRE(client.getTickStats().packetsSent == moves + 2);
+    REQUIRE(client.getTickStats().bytesSent == moves * (2 + sizeof(playerMoved)) + 2 + hello.size() + 2);
+
+    std::size_t pushed = 0;
+    std::size_t received = 0;
+    Engine::Network::TransportStats total;
+
+    for (int attempt = 0; attempt < 500 && received < moves + 2; attempt++) {
+        pushed += server.dispatch();
+        received += server.getTickStats().packetsReceived;
+        total.bytesReceived += server.getTickStats().bytesReceived;
+        total.packetsDropped += server.getTickStats().packetsDropped;
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    REQUIRE(received == moves + 2);
+    REQUIRE(pushed == moves + 1);
+    REQUIRE(total.packetsDropped == 1);
+    REQUIRE(total.bytesReceived == client.getTickStats().bytesSent);
+
+    auto &moved = events.getEventsByType<playerMoved>();
+
+    REQUIRE(moved.size() == moves);
+    REQUIRE(moved.back().player == moves - 1);
+    REQUIRE(events.getEventsByType<chatMessage>().front().text == hello);
+    moved.clear();
+    events.getEventsByType<chatMessage>().clear();
+}
+
+struct timerExpired
+{
+        std::size_t entity;
+};
+
+TEST_CASE("Timer wheel", "[World]")
+{
+    Engine::Core::World world;
+    auto &events = Engine::Event::EventManager::getInstance();
+    std::vector<std::pair<std::uint64_t, std::uint64_t>> fired;
+    const auto record = [&fired](std::uint64_t aDelay) {
+        return [&fired, aDelay](Engine::Core::World &aWorld) {
+            fired.emplace_back(aDelay, aWorld.getTimers().now());
+        };
+    };
+
+    for (const std::uint64_t delay : {1U, 255U, 256U, 300U, 65536U, 70000U}) {
+        world.addTimer(delay, record(delay));
+    }
+    const auto cancelled = world.addTimer(500, record(500));
+    const auto entity = world.createEntity();
+
+    world.addTimer(entity, 10, record(10));
+    world.addTimer(entity, 1000, record(1000));
+    REQUIRE(world.getTimers().size() == 9);
+    REQUIRE(world.cancelTimer(cancelled));
+    REQUIRE_FALSE(world.cancelTimer(cancelled));
+    REQUIRE_FALSE(world.getTimers().isPending(cancelled));
+
+    for (int tick = 0; tick < 20; tick++) {
+        world.runSystems();
+    }
+    REQUIRE(fired.size() == 2);
+    world.killEntity(entity);
+    REQUIRE(world.getTimers().size() == 5);
+    REQUIRE(world.getTimers().advance(world, 70000 - 20) == 5);
+    REQUIRE(world.getTimers().size() == 0);
+    for (const auto &[delay, tick] : fired) {
+        REQUIRE(delay == tick);
+    }
+
+    std::size_t chain = 0;
+    std::function<void(Engine::Core::World &)> reschedule = [&chain, &reschedule](Engine::Core::World &aWorld) {
+        if (++chain < 3) {
+            aWorld.addTimer(1, reschedule);
+        }
+    };
+
+    world.addTimer(1, reschedule);
+    REQUIRE(world.getTimers().advance(world, 2) == 2);
+    REQUIRE(chain == 2);
+    REQUIRE(world.getTimers().advance(world, 5) == 1);
+    REQUIRE(chain == 3);
+
+    events.initEventHandler<timerExpired>();
+    const auto owner = world.createEntity();
+    const auto moved = world.createEntity();
+
+    world.addTimerEvent(moved, 3, timerExpired {moved});
+    world.killEntity(owner);
+    const auto remap = world.defragment();
+
+    world.getTimers().advance(world, 2);
+    REQUIRE(events.getEventsByType<timerExpired>().empty());
+    world.runSystems();
+    REQUIRE(events.getEventsByType<timerExpired>().size() == 1);
+    REQUIRE(remap[events.getEventsByType<timerExpired>().front().entity] == 0);
+    events.getEventsByType<timerExpired>().clear();
+    world.addTimer(remap[moved], 5, record(5));
+    world.killEntity(remap[moved]);
+    REQUIRE(world.getTimers().size() == 0);
+}
+
+struct inventory
+{
+        std::array<int, 64> items;
+};
+
+template<>
+struct Engine::Core::ComponentStorage<inventory>
+{
+        using type = Engine::Core::PagedArray<inventory, 16>;
+};
+
+TEST_CASE("Paged component storage", "[World]")
+{
+    Engine::Core::World world;
+    constexpr std::size_t spawned = 1000;
+
+    world.registerComponents<inventory>();
+    const auto first = world.createEntity();
+    auto &firstInventory = world.addComponentToEntity(first, inventory {{42}});
+
+    for (std::size_t idx = 0; idx < spawned; idx++) {
+        world.addComponentToEntity(world.createEntity(), inventory {{static_cast<int>(idx)}});
+    }
+    auto &storage = world.getComponent<inventory>();
+
+    REQUIRE(&storage.get(first) == &firstInventory);
+    REQUIRE(firstInventory.items[0] == 42);
+    REQUIRE(storage.get(spawned).items[0] == static_cast<int>(spawned - 1));
+    REQUIRE(world.getMemoryStats<inventory>().liveSlots == spawned + 1);
+
+    const auto empty = world.createEntity();
+
+    REQUIRE_FALSE(storage.has(empty));
+    REQUIRE_THROWS_AS(storage.get(empty), Engine::Core::PagedArrayExceptionEmpty);
+    REQUIRE_THROWS_AS(storage.has(empty + 1), Engine::Core::PagedArrayExceptionOutOfRange);
+
+    const auto forked = world.fork();
+
+    for (std::size_t idx = 1; idx <= spawned; idx++) {
+        world.killEntity(idx);
+    }
+    REQUIRE(forked.getComponent<inventory>().get(spawned).items[0] == static_cast<int>(spawned - 1));
+    const auto before = world.getMemoryStats<inventory>().bytesReserved;
+
+    world.compact();
+    REQUIRE(world.getMemoryStats<inventory>().bytesReserved < before);
+    REQUIRE(world.getComponent<inventory>().get(first).items[0] == 42);
+
+    Engine::Core::PagedArray<inventory, 16> paged;
+
+    paged.emplace(3, inventory {{7}});
+    paged.relocate(3, 40);
+    REQUIRE_FALSE(paged.has(3));
+    REQUIRE(paged.get(40).items[0] == 7);
+    REQUIRE(paged.memoryStats().slots == 41);
+}
+
+TEST_CASE("Throw-free accessors", "[World]")
+{
+    Engine::Core::World world;
+
+    world.registerComponents<hp2, frozen, transform, inventory>();
+    const auto entity = world.createEntity();
+
+    REQUIRE(world.tryGetComponent<hp2>(entity) == nullptr);
+    REQUIRE(world.tryGetComponent<hp2>(entity + 1) == nullptr);
+    REQUIRE(world.tryGetComponent<collider>(entity) == nullptr);
+    REQUIRE(world.tryAddComponentToEntity(entity, hp2 {5}));
+    REQUIRE(world.tryEmplaceComponentToEntity<transform>(entity, 3));
+    REQUIRE(world.tryAddComponentToEntity(entity, frozen {}));
+    REQUIRE(world.tryAddComponentToEntity(entity, inventory {{4}}));
+    REQUIRE(world.tryGetComponent<hp2>(entity)->maxHp == 5);
+    REQUIRE(world.tryGetComponent<transform>(entity)->x == 3);
+    REQUIRE(world.tryGetComponent<frozen>(entity) != nullptr);
+    REQUIRE(std::as_const(world).tryGetComponent<inventory>(entity)->items[0] == 4);
+    REQUIRE(&world.getComponent<hp2>().getUnchecked(entity) == world.tryGetComponent<hp2>(entity));
+
+    const auto notRegistered = world.tryAddComponentToEntity(entity, collider {1});
+
+    REQUIRE_FALSE(notRegistered);
+    REQUIRE(notRegistered.error() == Engine::Core::WorldError::ComponentNotRegistered);
+    REQUIRE(world.tryAddComponentToEntity(entity + 1, hp2 {}).error()
+            == Engine::Core::WorldError::EntityOutOfRange);
+    REQUIRE(world.tryRemoveComponentFromEntity<hp2>(entity));
+    REQUIRE(world.tryRemoveComponentFromEntity<hp2>(entity).error()
+            == Engine::Core::WorldError::ComponentMissing);
+    REQUIRE(world.tryGetComponent<hp2>(entity) == nullptr);
+    REQUIRE_FALSE(world.hasComponents<hp2>(entity));
+
+    const Engine::Core::Expected<int, Engine::Core::WorldError> value = 42;
+    const Engine::Core::Expected<int, Engine::Core::WorldError> error =
+        Engine::Core::Unexpected(Engine::Core::WorldError::ComponentMissing);
+
+    REQUIRE(*value == 42);
+    REQUIRE(error.value_or(7) == 7);
+}
+
+TEST_CASE("External entity ids", "[World]")
+{
+    Engine::Core::World world;
+    constexpr std::size_t replicated = 1000;
+    constexpr std::uint64_t firstExternal = 0xdeadbeef00000000ULL;
+    constexpr std::uint64_t stride = 0x100000007ULL;
+
+    world.registerComponents<hp2>();
+    for (std::size_t idx = 0; idx < replicated; idx++) {
+        const auto entity = world.createEntity(firstExternal + idx * stride);
+
+        world.addComponentToEntity(entity, hp2 {static_cast<int>(idx)});
+    }
+    REQUIRE(world.getCurrentId() == replicated);
+    REQUIRE(world.getMemoryStats<hp2>().slots == replicated);
+    REQUIRE_THROWS_AS(world.createEntity(firstExternal), Engine::Core::EntityIndexExceptionAlreadyBound);
+    REQUIRE(world.getCurrentId() == replicated);
+
+    const auto last = world.findEntity(firstExternal + (replicated - 1) * stride);
+
+    REQUIRE(world.getComponent<hp2>().get(last).maxHp == static_cast<int>(replicated - 1));
+    REQUIRE(world.getExternalId(last) == firstExternal + (replicated - 1) * stride);
+    REQUIRE(world.findEntity(42) == Engine::Core::World::nullId);
+    REQUIRE(world.getExternalId(world.createEntity()) == Engine::Core::EntityIndex::noExternalId);
+
+    world.killEntity(world.findEntity(firstExternal));
+    REQUIRE(world.findEntity(firstExternal) == Engine::Core::World::nullId);
+    const auto respawned = world.createEntity(firstExternal);
+
+    REQUIRE(respawned == 0);
+    world.killEntity(world.findEntity(firstExternal + stride));
+    const auto remap = world.defragment();
+
+    REQUIRE(world.findEntity(firstExternal + (replicated - 1) * stride) == remap[last]);
+    REQUIRE(world.getComponent<hp2>().get(remap[last]).maxHp == static_cast<int>(replicated - 1));
+    REQUIRE(world.findEntity(firstExternal + stride) == Engine::Core::World::nullId);
+    REQUIRE(world.getExternalId(remap[last]) == firstExternal + (replicated - 1) * stride);
+}
+
+TEST_CASE("System scheduling", "[World]")
+{
+    Engine::Core::World world;
+    constexpr std::size_t entities = 1000;
+    std::vector<std::size_t> runs;
+    std::size_t slowRuns = 0;
+    std::size_t otherSlowRuns = 0;
+
+    world.registerComponents<hp1>();
+    for (std::size_t idx = 0; idx < entities; idx++) {
+        world.addComponentToEntity(world.createEntity(), hp1 {0});
+    }
+    auto slow = Engine::Core::createSystem<hp1>(
+        world, "slow", [&slowRuns](Engine::Core::World &aWorld, double /*deltaTime*/, std::size_t aIdx, hp1 & /*hp*/) {
+            if (aIdx == 0) {
+                slowRuns++;
+                REQUIRE(aWorld.getTick() % 3 == 0);
+            }
+        });
+    auto otherSlow = Engine::Core::createSystem<hp1>(
+        world, "otherSlow",
+        [&otherSlowRuns](Engine::Core::World &aWorld, double /*deltaTime*/, std::size_t aIdx, hp1 & /*hp*/) {
+            if (aIdx == 0) {
+                otherSlowRuns++;
+                REQUIRE(aWorld.getTick() % 3 == 1);
+            }
+        });
+    auto sliced = Engine::Core::createSystem<hp1>(
+        world, "sliced", [](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/, hp1 &aHp) {
+            aHp.hp++;
+        });
+
+    slow.second->setInterval(3);
+    otherSlow.second->setInterval(3);
+    sliced.second->setSlices(4);
+    world.addSystem(slow);
+    world.addSystem(otherSlow);
+    world.addSystem(sliced);
+    REQUIRE(world.getSystem("otherSlow").getPhase() == 1);
+    REQUIRE_THROWS_AS(world.getSystem("missing"), Engine::Core::WorldExceptionSystemNotRegistered);
+
+    const auto countHp = [&world](int aHp) {
+        std::size_t count = 0;
+
+        world.query<hp1>().forEach(0, [&count, aHp](Engine::Core::World & /*world*/, double /*deltaTime*/,
+                                                     std::size_t /*idx*/, hp1 &aComp) {
+            count += aComp.hp == aHp ? 1 : 0;
+        });
+        return count;
+    };
+
+    world.runSystems();
+    REQUIRE(countHp(1) == entities / 4);
+    for (int tick = 1; tick < 4; tick++) {
+        world.runSystems();
+    }
+    REQUIRE(countHp(1) == entities);
+    for (int tick = 4; tick < 6; tick++) {
+        world.runSystems();
+    }
+    REQUIRE(world.getTick() == 6);
+    REQUIRE(slowRuns == 2);
+    REQUIRE(otherSlowRuns == 2);
+
+    world.removeSystem(sliced.first);
+    auto budgeted = Engine::Core::createSystem<hp1>(
+        world, "budgeted", [](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/, hp1 &aHp) {
+            aHp.hp = 10;
+        });
+
+    budgeted.second->setBudget(std::chrono::nanoseconds(1));
+    world.addSystem(budgeted);
+    world.runSystems();
+    REQUIRE(countHp(10) > 0);
+    REQUIRE(countHp(10) < entities);
+    for (int tick = 0; tick < 10 && countHp(10) < entities; tick++) {
+        world.runSystems();
+    }
+    REQUIRE(countHp(10) == entities);
+}
+
+struct arenaChat
+{
+        std::size_t sender;
+        std::string_view text;
+        std::span<const std::uint32_t> targets;
+};
+
+TEST_CASE("Event payload arena", "[Event]")
+{
+    auto &manager = Engine::Event::EventManager::getInstance();
+    auto &arena = manager.getArena();
+    const std::vector<std::uint32_t> targets {1, 2, 3};
+    constexpr std::size_t messages = 100;
+
+    arena.reset();
+    manager.initEventHandler<arenaChat>();
+    for (std::size_t idx = 0; idx < messages; idx++) {
+        const auto text = "message " + std::to_string(idx);
+
+        manager.pushEvent(arenaChat {idx, arena.store(text), arena.store(std::span<const std::uint32_t>(targets))});
+    }
+    const auto &events = manager.getEventsByType<arenaChat>();
+
+    REQUIRE(events.size() == messages);
+    REQUIRE(events.back().text == "message 99");
+    REQUIRE(events.front().targets.size() == targets.size());
+    REQUIRE(events.front().targets[2] == 3);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(events.front().targets.data()) % alignof(std::uint32_t) == 0);
+    REQUIRE(arena.bytesUsed() >= messages * (std::string("message 0").size() + sizeof(std::uint32_t) * 3));
+
+    const auto *large = static_cast<std::byte *>(arena.allocate(Engine::Event::EventArena::defaultChunkSize * 2, 64));
+
+    REQUIRE(reinterpret_cast<std::uintptr_t>(large) % 64 == 0);
+    REQUIRE(events.back().text == "message 99");
+    const auto reserved = arena.bytesReserved();
+
+    manager.keepEventsAndClear<>();
+    arena.reset();
+    REQUIRE(arena.bytesUsed() == 0);
+    REQUIRE(arena.store("again") == "again");
+    REQUIRE(arena.store(std::string_view()).empty());
+    REQUIRE(arena.bytesReserved() == reserved);
+    arena.reset();
+}
+
+struct heat
+{
+        int value;
+};
+
+template<>
+struct Engine::Core::ComponentStorage<heat>
+{
+        using type = Engine::Core::DoubleBufferedArray<heat>;
+};
+
+TEST_CASE("Double-buffered components", "[World]")
+{
+    Engine::Core::World world;
+    Engine::Core::JobSystem jobs(3);
+    constexpr std::size_t entities = 1000;
+
+    world.registerComponents<heat>();
+    for (std::size_t idx = 0; idx < entities; idx++) {
+        world.addComponentToEntity(world.createEntity(), heat {static_cast<int>(idx)});
+    }
+    auto &storage = world.getComponent<heat>();
+
+    REQUIRE(storage.getPrevious(10).value == 10);
+    world.query<heat>().forEachParallel(
+        0,
+        [&storage](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t aIdx, heat &aHeat) {
+            aHeat.value = storage.getPrevious((aIdx + 1) % entities).value;
+        },
+        64, jobs);
+    REQUIRE(storage.get(10).value == 11);
+    REQUIRE(storage.getPrevious(10).value == 10);
+    REQUIRE(world.swapBuffers() == entities);
+    REQUIRE(storage.getPrevious(10).value == 11);
+    REQUIRE(storage.getPrevious(entities - 1).value == 0);
+    REQUIRE(world.swapBuffers() == 0);
+
+    auto cooling = Engine::Core::createSystem<heat, Engine::Core::Previous<heat>>(
+        world, "cooling",
+        [](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/, heat &aHeat,
+           const heat &aPrevious) {
+            aHeat.value = aPrevious.value - 1;
+        });
+
+    world.addSystem(cooling);
+    world.runSystems();
+    world.runSystems();
+    REQUIRE(storage.getPrevious(10).value == 9);
+    REQUIRE(storage.get(10).value == 9);
+
+    const auto spawned = world.createEntity();
+
+    world.addComponentToEntity(spawned, heat {100});
+    REQUIRE(storage.getPrevious(spawned).value == 100);
+    world.killEntity(spawned);
+    REQUIRE(storage.tryGetPrevious(spawned) == nullptr);
+
+    auto forked = world.fork();
+
+    forked.getComponent<heat>().get(10).value = 50;
+    REQUIRE(forked.swapBuffers() == 1);
+    REQUIRE(forked.getComponent<heat>().getPrevious(10).value == 50);
+    REQUIRE(world.getComponent<heat>().getPrevious(10).value == 9);
+    REQUIRE(world.getMemoryStats<heat>().bytesLive == 2 * entities * sizeof(heat));
+
+    std::string coolingName = "cooling";
+
+    world.removeSystem(coolingName);
+    world.removeComponent<heat>();
+    REQUIRE(world.swapBuffers() == 0);
+    REQUIRE_NOTHROW(world.runSystems());
+}
+
+TEST_CASE("Static worlds", "[World]")
+{
+    using staticWorld = Engine::Core::StaticWorld<hp1, hp2, frozen>;
+    static_assert(staticWorld::getComponentBit<hp2>() == 1);
+
+    auto created = std::make_unique<staticWorld>();
+    auto &world = *created;
+    constexpr std::size_t entities = 100;
+
+    for (std::size_t idx = 0; idx < entities; idx++) {
+        const auto entity = world.createEntity();
+
+        world.addComponentToEntity(entity, hp1 {0});
+        if (idx % 2 == 0) {
+            world.emplaceComponentToEntity<hp2>(entity, 10);
+        }
+        if (idx % 10 == 0) {
+            world.addComponentToEntity(entity, frozen {});
+        }
+    }
+    REQUIRE(world.getComponentBit<frozen>() == world.Engine::Core::World::getComponentBit<frozen>());
+    std::size_t matched = 0;
+
+    world.query<hp1, hp2, Engine::Core::Without<frozen>>().forEach(
+        0, [&matched](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/, hp1 &aHp,
+                      const hp2 &aMaxHp) {
+            aHp.hp = aMaxHp.maxHp;
+            matched++;
+        });
+    REQUIRE(matched == entities / 2 - entities / 10);
+    REQUIRE(world.getComponent<hp1>()[2].hp == 10);
+    REQUIRE(world.getComponent<hp1>()[10].hp == 0);
+
+    world.removeComponentFromEntity<hp2>(2);
+    world.killEntity(4);
+    REQUIRE_FALSE(world.getComponent<hp2>().has(2));
+    REQUIRE_FALSE(world.getComponent<hp1>().has(4));
+    REQUIRE(world.createEntity() == 4);
+    REQUIRE_FALSE(world.getComponent<hp1>().has(4));
+    world.Engine::Core::World::killEntity(4);
+
+    auto heal = Engine::Core::createSystem<hp1, Engine::Core::Optional<hp2>>(
+        world, "heal",
+        [](Engine::Core::World & /*world*/, double /*deltaTime*/, std::size_t /*idx*/, hp1 &aHp, hp2 *aMaxHp) {
+            aHp.hp += aMaxHp != nullptr ? 1 : 2;
+        });
+
+    world.addSystem(heal);
+    auto forked = world.fork();
+    Engine::Core::World &generic = forked;
+
+    REQUIRE_THROWS_AS(generic.removeComponent<hp2>(), Engine::Core::WorldExceptionComponentsFrozen);
+    REQUIRE_THROWS_AS(generic.registerComponent<heat>(), Engine::Core::WorldExceptionComponentsFrozen);
+
+    Engine::App app;
+
+    app.addWorld(0, std::move(created));
+    app.tick(0);
+    REQUIRE(app[0]->getComponent<hp1>()[6].hp == 11);
+    REQUIRE(app[0]->getComponent<hp1>()[1].hp == 2);
+    REQUIRE(forked.getComponent<hp1>()[6].hp == 10);
+    REQUIRE(forked.getComponent<hp1>()[1].hp == 0);
+    REQUIRE_FALSE(forked.getComponent<hp1>().has(4));
+}